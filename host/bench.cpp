@@ -0,0 +1,531 @@
+// 24cxxprog_bench - throughput of every bulk operation on every chip type
+// Runs against the simulated bus, so modeled bus time, transactions and write
+// cycles are deterministic and can be compared between commits
+#include "i2c_24c02_sim.hpp"
+#include "../i2c_24c02_chips.hpp"
+#include "../i2c_24c02_ops.hpp"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+// Relative growth of a deterministic counter reported as regression
+#define BENCH_REGRESSION_PERCENT 2
+
+#define BENCH_CSV_HEADER \
+    "chip,workload,bytes,wall_us,bus_us,transactions,polls,write_cycles,peak_heap,result,acquires"
+
+typedef enum {
+    Workload_Read,
+    Workload_Restore,
+    Workload_Verify,
+    Workload_VerifyCrc,
+    Workload_Erase,
+    Workload_Dump,
+    Workload_Search,
+    Workload_Commit,
+    Workload_Range,
+    Workload_Count
+} Workload;
+
+static const char* workload_names[Workload_Count] =
+    {"read", "restore", "verify", "crcverify", "erase", "dump", "search", "commit", "range"};
+
+typedef struct {
+    char chip[16];
+    char workload[16];
+    uint32_t bytes;
+    uint64_t wall_us;
+    uint64_t bus_us;
+    uint32_t transactions;
+    uint32_t polls;
+    uint32_t write_cycles;
+    uint32_t peak_heap;
+    bool ok;
+    uint32_t acquires;
+} BenchResult;
+
+// Heap accounting - every malloc/free in the driver, ops and bench goes through
+// these wrappers (linked with -Wl,--wrap=malloc,--wrap=free)
+extern "C" void* __real_malloc(size_t size);
+extern "C" void __real_free(void* ptr);
+
+static size_t heap_current = 0;
+static size_t heap_peak = 0;
+
+// Header keeps allocation size and max_align_t alignment
+#define HEAP_HEADER 16
+
+extern "C" void* __wrap_malloc(size_t size) {
+    uint8_t* block = static_cast<uint8_t*>(__real_malloc(size + HEAP_HEADER));
+    if(block == nullptr) return nullptr;
+
+    *reinterpret_cast<size_t*>(block) = size;
+    heap_current += size;
+    if(heap_current > heap_peak) heap_peak = heap_current;
+    return block + HEAP_HEADER;
+}
+
+extern "C" void __wrap_free(void* ptr) {
+    if(ptr == nullptr) return;
+
+    uint8_t* block = static_cast<uint8_t*>(ptr) - HEAP_HEADER;
+    heap_current -= *reinterpret_cast<size_t*>(block);
+    __real_free(block);
+}
+
+static uint64_t wall_clock_us() {
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return static_cast<uint64_t>(now.tv_sec) * 1000000ULL + now.tv_nsec / 1000;
+}
+
+// Source reading from an in-memory image, optionally as slow as an SD card
+typedef struct {
+    const uint8_t* data;
+    uint32_t offset;
+    EEPROMSimTransport* transport;
+    uint32_t sd_us_per_kb;
+} MemorySource;
+
+static bool memory_source_read(void* context, uint8_t* buffer, uint32_t length) {
+    MemorySource* source = static_cast<MemorySource*>(context);
+    memcpy(buffer, &source->data[source->offset], length);
+    source->offset += length;
+    source->transport->elapse(static_cast<uint64_t>(length) * source->sd_us_per_kb * 1000 / 1024);
+    return true;
+}
+
+// Sink collecting a dump in memory
+typedef struct {
+    uint8_t* data;
+    uint32_t offset;
+    uint8_t* chunk;
+} MemorySink;
+
+static uint8_t* memory_sink_acquire(void* context) {
+    return static_cast<MemorySink*>(context)->chunk;
+}
+
+static bool memory_sink_submit(void* context, uint8_t* buffer, uint32_t length) {
+    MemorySink* sink = static_cast<MemorySink*>(context);
+    memcpy(&sink->data[sink->offset], buffer, length);
+    sink->offset += length;
+    return true;
+}
+
+// Deterministic test image
+static void fill_image(uint8_t* image, uint32_t size, uint32_t seed) {
+    uint32_t state = seed * 2654435761u + 1;
+    for(uint32_t i = 0; i < size; i++) {
+        state ^= state << 13;
+        state ^= state >> 17;
+        state ^= state << 5;
+        image[i] = state & 0xFF;
+    }
+}
+
+static void chip_name(EEPROMType type, char* buffer, size_t buffer_size) {
+    snprintf(buffer, buffer_size, "%s", get_eeprom_traits(type).name);
+}
+
+// Run one workload on a chip, device state carries over between workloads
+// Bytes of the ranged restore, a slice of a big chip and a quarter of a small one
+static uint32_t bench_range_length(uint32_t size) {
+    return (size / 4 < 256) ? size / 4 : 256;
+}
+
+static bool run_workload(
+    Workload workload,
+    EEPROM24C02* eeprom,
+    EEPROMSimTransport* transport,
+    uint32_t size,
+    const uint8_t* image,
+    uint8_t* buffer,
+    uint8_t* chunk,
+    bool smart_write,
+    uint32_t sd_us_per_kb) {
+    switch(workload) {
+    case Workload_Read:
+        return eeprom->readSequential(0, buffer, size);
+    case Workload_Restore: {
+        MemorySource source = {image, 0, transport, sd_us_per_kb};
+        EEPROMWriteStats stats;
+        // Plain write; readback is measured by the verify workload
+        return eeprom_op_write(
+                   eeprom,
+                   0,
+                   size,
+                   memory_source_read,
+                   &source,
+                   smart_write,
+                   false,
+                   nullptr,
+                   nullptr,
+                   &stats) == EEPROMOpOk;
+    }
+    case Workload_Verify: {
+        MemorySource source = {image, 0, transport, sd_us_per_kb};
+        EEPROMVerifyStats stats;
+        return eeprom_op_verify(
+                   eeprom, 0, size, memory_source_read, &source, nullptr, nullptr, &stats) ==
+               EEPROMOpOk;
+    }
+    case Workload_VerifyCrc: {
+        // Checksum stored with the dump, no source reads
+        EEPROMVerifyStats stats;
+        uint32_t crc = eeprom_crc32(EEPROM_CRC32_INIT, image, size);
+        return eeprom_op_verify_crc(eeprom, 0, size, crc, nullptr, nullptr, &stats) ==
+               EEPROMOpOk;
+    }
+    case Workload_Erase: {
+        EEPROMEraseStats stats;
+        return eeprom_op_erase(eeprom, 0, size, nullptr, &stats) == EEPROMOpOk;
+    }
+    case Workload_Dump: {
+        MemorySink sink_data = {buffer, 0, chunk};
+        EEPROMDumpSink sink = {memory_sink_acquire, memory_sink_submit, &sink_data};
+        uint32_t crc;
+        return eeprom_op_dump(eeprom, 0, size, &sink, &crc, nullptr) == EEPROMOpOk &&
+               crc == eeprom_crc32(EEPROM_CRC32_INIT, image, size);
+    }
+    case Workload_Search: {
+        // Worst case: the only match is the image's last bytes, one wildcard among them
+        EEPROMPattern pattern;
+        pattern.length = EEPROM_PATTERN_MAX;
+        for(uint8_t i = 0; i < pattern.length; i++) {
+            pattern.bytes[i] = image[size - pattern.length + i];
+            pattern.wild[i] = (i == 2);
+        }
+        eeprom_pattern_compile(&pattern);
+        uint32_t match;
+        return eeprom_op_search(eeprom, 0, size, &pattern, false, &match, nullptr) ==
+                   EEPROMOpOk &&
+               match == size - pattern.length;
+    }
+    case Workload_Commit: {
+        // 50 edited bytes in four clusters, as from the device editor
+        static EEPROMEditBuffer edits;
+        eeprom_edit_reset(&edits, size, eeprom->getGeometry().page_size);
+        for(uint32_t i = 0; i < 50; i++) {
+            uint32_t address = (i % 4) * (size / 4) + (i / 4) * 3;
+            eeprom_edit_set(&edits, address % size, ~image[address % size]);
+        }
+        EEPROMWriteStats stats;
+        return eeprom_op_commit(eeprom, &edits, nullptr, &stats) == EEPROMOpOk &&
+               edits.count == 0;
+    }
+    case Workload_Range: {
+        // Unaligned window from the middle of the file to the middle of the chip, with readback
+        uint32_t length = bench_range_length(size);
+        MemorySource source = {image, size / 4 + 1, transport, sd_us_per_kb};
+        EEPROMWriteStats stats;
+        return eeprom_op_write(
+                   eeprom,
+                   size / 2 + 3,
+                   length,
+                   memory_source_read,
+                   &source,
+                   smart_write,
+                   true,
+                   nullptr,
+                   nullptr,
+                   &stats) == EEPROMOpOk;
+    }
+    default:
+        return false;
+    }
+}
+
+// All workloads on one chip type: read blank, restore image, verify both ways, dump,
+// search, edit, ranged restore, erase
+static uint32_t bench_chip(
+    EEPROMType type,
+    uint32_t clock_hz,
+    long write_cycle_us,
+    bool smart_write,
+    uint32_t sd_us_per_kb,
+    BenchResult* results) {
+    static const Workload order[] = {
+        Workload_Read,
+        Workload_Restore,
+        Workload_Verify,
+        Workload_VerifyCrc,
+        Workload_Dump,
+        Workload_Search,
+        Workload_Commit,
+        Workload_Range,
+        Workload_Erase};
+    const EEPROMGeometry& geometry = get_eeprom_geometry(type);
+
+    EEPROMSimDevice device(geometry, EEPROM_24C02_BASE_ADDR);
+    if(write_cycle_us >= 0) device.setWriteCycleTime(write_cycle_us);
+    EEPROMSimTransport transport(clock_hz);
+    transport.attach(&device);
+    EEPROM24C02 eeprom(&transport, EEPROM_24C02_BASE_ADDR);
+    eeprom.setGeometry(geometry);
+    eeprom.setWriteCycleTimeout(geometry.write_cycle_ms * 2);
+
+    uint8_t* image = static_cast<uint8_t*>(malloc(geometry.size));
+    uint8_t* buffer = static_cast<uint8_t*>(malloc(geometry.size));
+    uint8_t* chunk = static_cast<uint8_t*>(malloc(EEPROM_OP_DUMP_CHUNK));
+    fill_image(image, geometry.size, type);
+
+    uint32_t count = 0;
+    for(size_t i = 0; i < sizeof(order) / sizeof(order[0]); i++) {
+        BenchResult* result = &results[count++];
+        chip_name(type, result->chip, sizeof(result->chip));
+        snprintf(result->workload, sizeof(result->workload), "%s", workload_names[order[i]]);
+        result->bytes =
+            (order[i] == Workload_Range) ? bench_range_length(geometry.size) : geometry.size;
+
+        transport.resetStats();
+        uint64_t bus_start = transport.getTimeNs();
+        heap_peak = heap_current;
+        size_t heap_start = heap_current;
+        uint64_t wall_start = wall_clock_us();
+
+        result->ok = run_workload(
+            order[i],
+            &eeprom,
+            &transport,
+            geometry.size,
+            image,
+            buffer,
+            chunk,
+            smart_write,
+            sd_us_per_kb);
+
+        result->wall_us = wall_clock_us() - wall_start;
+        result->bus_us = (transport.getTimeNs() - bus_start) / 1000;
+        result->peak_heap = heap_peak - heap_start;
+        result->transactions = transport.getStats().transactions;
+        result->polls = transport.getStats().polls;
+        result->write_cycles = transport.getStats().write_cycles;
+        result->acquires = transport.getStats().acquires;
+
+        // Dump must reproduce the restored image
+        if(order[i] == Workload_Dump && memcmp(buffer, image, geometry.size) != 0) {
+            result->ok = false;
+        }
+    }
+
+    free(chunk);
+    free(buffer);
+    free(image);
+    return count;
+}
+
+static void print_csv(FILE* out, const BenchResult* result) {
+    fprintf(
+        out,
+        "%s,%s,%u,%llu,%llu,%u,%u,%u,%u,%s,%u\n",
+        result->chip,
+        result->workload,
+        result->bytes,
+        (unsigned long long)result->wall_us,
+        (unsigned long long)result->bus_us,
+        result->transactions,
+        result->polls,
+        result->write_cycles,
+        result->peak_heap,
+        result->ok ? "ok" : "fail",
+        result->acquires);
+}
+
+static void print_table(const BenchResult* results, uint32_t count) {
+    printf(
+        "%-7s %-9s %7s %10s %11s %10s %7s %7s %7s %6s %9s\n",
+        "chip",
+        "workload",
+        "bytes",
+        "wall ms",
+        "bus ms",
+        "bus B/s",
+        "trans",
+        "cycles",
+        "locks",
+        "heap",
+        "result");
+    for(uint32_t i = 0; i < count; i++) {
+        const BenchResult* result = &results[i];
+        double bus_ms = result->bus_us / 1000.0;
+        printf(
+            "%-7s %-9s %7u %10.3f %11.2f %10.0f %7u %7u %7u %6u %9s\n",
+            result->chip,
+            result->workload,
+            result->bytes,
+            result->wall_us / 1000.0,
+            bus_ms,
+            bus_ms > 0 ? result->bytes * 1000.0 / bus_ms : 0.0,
+            result->transactions,
+            result->write_cycles,
+            result->acquires,
+            result->peak_heap,
+            result->ok ? "ok" : "FAIL");
+    }
+}
+
+// Compare deterministic counters with an earlier CSV run, returns regression count
+static uint32_t compare_baseline(const char* path, const BenchResult* results, uint32_t count) {
+    FILE* file = fopen(path, "r");
+    if(file == nullptr) {
+        fprintf(stderr, "cannot open baseline %s\n", path);
+        return 1;
+    }
+
+    uint32_t regressions = 0;
+    char line[256];
+    while(fgets(line, sizeof(line), file)) {
+        BenchResult base;
+        unsigned long long wall_us, bus_us;
+        char ok[8];
+        base.acquires = 0;
+        if(sscanf(
+               line,
+               "%15[^,],%15[^,],%u,%llu,%llu,%u,%u,%u,%u,%7[^,],%u",
+               base.chip,
+               base.workload,
+               &base.bytes,
+               &wall_us,
+               &bus_us,
+               &base.transactions,
+               &base.polls,
+               &base.write_cycles,
+               &base.peak_heap,
+               ok,
+               &base.acquires) < 10) {
+            continue;
+        }
+        base.bus_us = bus_us;
+
+        for(uint32_t i = 0; i < count; i++) {
+            const BenchResult* result = &results[i];
+            if(strcmp(result->chip, base.chip) != 0 ||
+               strcmp(result->workload, base.workload) != 0) {
+                continue;
+            }
+
+            const struct {
+                const char* name;
+                uint64_t before;
+                uint64_t after;
+            } metrics[] = {
+                {"bus_us", base.bus_us, result->bus_us},
+                {"transactions", base.transactions, result->transactions},
+                {"write_cycles", base.write_cycles, result->write_cycles},
+                {"peak_heap", base.peak_heap, result->peak_heap},
+                {"acquires", base.acquires, result->acquires},
+            };
+            for(size_t m = 0; m < sizeof(metrics) / sizeof(metrics[0]); m++) {
+                // Counters missing from older baselines read as 0 and are skipped
+                if(metrics[m].before == 0 && strcmp(metrics[m].name, "acquires") == 0) continue;
+                if(metrics[m].after * 100 >
+                   metrics[m].before * (100 + BENCH_REGRESSION_PERCENT)) {
+                    fprintf(
+                        stderr,
+                        "REGRESSION %s %s %s: %llu -> %llu\n",
+                        result->chip,
+                        result->workload,
+                        metrics[m].name,
+                        (unsigned long long)metrics[m].before,
+                        (unsigned long long)metrics[m].after);
+                    regressions++;
+                }
+            }
+        }
+    }
+
+    fclose(file);
+    return regressions;
+}
+
+static void usage() {
+    fprintf(
+        stderr,
+        "usage: 24cxxprog_bench [options]\n"
+        "  --clock <hz>       bus clock (default 100000)\n"
+        "  --twr <us>         actual write cycle time (default chip maximum)\n"
+        "  --no-smart         restore writes every page\n"
+        "  --sd <us>          modeled SD read time per KB for restore/verify (default 0)\n"
+        "  --chip <name>      only this chip (e.g. 24C256)\n"
+        "  --csv <file>       write machine-readable results ('-' for stdout)\n"
+        "  --baseline <file>  fail if counters grew more than %d%% over an earlier CSV\n",
+        BENCH_REGRESSION_PERCENT);
+}
+
+int main(int argc, char** argv) {
+    uint32_t clock_hz = 100000;
+    long write_cycle_us = -1;
+    bool smart_write = true;
+    uint32_t sd_us_per_kb = 0;
+    const char* only_chip = nullptr;
+    const char* csv_path = nullptr;
+    const char* baseline_path = nullptr;
+
+    for(int arg = 1; arg < argc; arg++) {
+        if(strcmp(argv[arg], "--clock") == 0 && arg + 1 < argc) {
+            clock_hz = strtoul(argv[++arg], nullptr, 0);
+        } else if(strcmp(argv[arg], "--twr") == 0 && arg + 1 < argc) {
+            write_cycle_us = strtol(argv[++arg], nullptr, 0);
+        } else if(strcmp(argv[arg], "--no-smart") == 0) {
+            smart_write = false;
+        } else if(strcmp(argv[arg], "--sd") == 0 && arg + 1 < argc) {
+            sd_us_per_kb = strtoul(argv[++arg], nullptr, 0);
+        } else if(strcmp(argv[arg], "--chip") == 0 && arg + 1 < argc) {
+            only_chip = argv[++arg];
+        } else if(strcmp(argv[arg], "--csv") == 0 && arg + 1 < argc) {
+            csv_path = argv[++arg];
+        } else if(strcmp(argv[arg], "--baseline") == 0 && arg + 1 < argc) {
+            baseline_path = argv[++arg];
+        } else {
+            usage();
+            return 2;
+        }
+    }
+    if(clock_hz == 0) {
+        usage();
+        return 2;
+    }
+
+    static BenchResult results[EEPROMType_Count * Workload_Count];
+    uint32_t count = 0;
+    for(int i = 0; i < EEPROMType_Count; i++) {
+        EEPROMType type = static_cast<EEPROMType>(i);
+        char name[16];
+        chip_name(type, name, sizeof(name));
+        if(only_chip && strcasecmp(only_chip, name) != 0) continue;
+
+        count += bench_chip(
+            type, clock_hz, write_cycle_us, smart_write, sd_us_per_kb, &results[count]);
+    }
+
+    bool csv_stdout = csv_path && strcmp(csv_path, "-") == 0;
+    if(!csv_stdout) {
+        print_table(results, count);
+    }
+
+    if(csv_path) {
+        FILE* out = csv_stdout ? stdout : fopen(csv_path, "w");
+        if(out == nullptr) {
+            fprintf(stderr, "cannot create %s\n", csv_path);
+            return 1;
+        }
+        fprintf(out, "%s\n", BENCH_CSV_HEADER);
+        for(uint32_t i = 0; i < count; i++) {
+            print_csv(out, &results[i]);
+        }
+        if(!csv_stdout) fclose(out);
+    }
+
+    bool failed = false;
+    for(uint32_t i = 0; i < count; i++) {
+        if(!results[i].ok) failed = true;
+    }
+
+    if(baseline_path && compare_baseline(baseline_path, results, count) > 0) {
+        failed = true;
+    }
+
+    return failed ? 1 : 0;
+}
@@ -0,0 +1,265 @@
+#include "i2c_24c02_sim.hpp"
+#include <stdlib.h>
+#include <string.h>
+
+// Bit periods of bus conditions (a byte is 8 data bits + ACK)
+#define SIM_BITS_START 1
+#define SIM_BITS_STOP  1
+#define SIM_BITS_BYTE  9
+
+EEPROMSimDevice::EEPROMSimDevice(const EEPROMGeometry& geometry, uint8_t i2c_address_7bit)
+    : _geometry(geometry)
+    , _i2c_addr_8bit(i2c_address_7bit << 1)
+    , _pointer(0)
+    , _word_bytes(0)
+    , _latch_count(0)
+    , _busy_until_ns(0)
+    , _write_cycle_ns(geometry.write_cycle_ms * 1000000UL)
+    , _write_protect(false)
+    , _flaky_every(0)
+    , _write_cycle_count(0) {
+    _memory = static_cast<uint8_t*>(malloc(_geometry.size));
+    memset(_memory, 0xFF, _geometry.size);
+    memset(_latch_valid, 0, sizeof(_latch_valid));
+}
+
+EEPROMSimDevice::~EEPROMSimDevice() {
+    free(_memory);
+}
+
+uint8_t* EEPROMSimDevice::memory() {
+    return _memory;
+}
+
+uint32_t EEPROMSimDevice::size() {
+    return _geometry.size;
+}
+
+void EEPROMSimDevice::setWriteCycleTime(uint32_t write_cycle_us) {
+    _write_cycle_ns = write_cycle_us * 1000UL;
+}
+
+void EEPROMSimDevice::setWriteProtect(bool write_protect) {
+    _write_protect = write_protect;
+}
+
+void EEPROMSimDevice::setFlakyWrites(uint32_t every) {
+    _flaky_every = every;
+}
+
+bool EEPROMSimDevice::respondsTo(uint8_t address) {
+    // 24C04/08/16 use A0-A2 as block select and answer on 2/4/8 addresses
+    uint8_t mask = static_cast<uint8_t>(~(((1 << _geometry.block_bits) - 1) << 1) & 0xFE);
+    return (address & mask) == (_i2c_addr_8bit & mask);
+}
+
+bool EEPROMSimDevice::isBusy(uint64_t now_ns) {
+    return now_ns < _busy_until_ns;
+}
+
+void EEPROMSimDevice::beginWrite(uint8_t address) {
+    // Block select bits become the top of the address counter
+    uint8_t block = (address >> 1) & ((1 << _geometry.block_bits) - 1);
+    _pointer = static_cast<uint32_t>(block) << 8;
+    _word_bytes = 0;
+}
+
+void EEPROMSimDevice::writeByte(uint8_t data) {
+    if(_word_bytes < _geometry.address_bytes) {
+        // Word address
+        if(_geometry.address_bytes == 2 && _word_bytes == 0) {
+            _pointer = static_cast<uint32_t>(data) << 8;
+        } else {
+            _pointer |= data;
+        }
+        _word_bytes++;
+        if(_word_bytes == _geometry.address_bytes) {
+            _pointer &= _geometry.size - 1;
+        }
+        return;
+    }
+
+    // Data goes to the page latch, the counter wraps within the page
+    uint32_t page_base = _pointer - (_pointer % _geometry.page_size);
+    uint32_t offset = _pointer - page_base;
+    _latch[offset] = data;
+    if(!_latch_valid[offset]) {
+        _latch_valid[offset] = true;
+        _latch_count++;
+    }
+    _pointer = page_base + (offset + 1) % _geometry.page_size;
+}
+
+uint8_t EEPROMSimDevice::readByte() {
+    // Sequential reads roll over at the end of the whole array
+    uint8_t data = _memory[_pointer];
+    _pointer = (_pointer + 1) % _geometry.size;
+    return data;
+}
+
+bool EEPROMSimDevice::stop(uint64_t now_ns) {
+    if(_latch_count == 0) return false;
+
+    uint32_t page_base = _pointer - (_pointer % _geometry.page_size);
+    bool program = !_write_protect;
+    bool flaky = program && _flaky_every && (++_write_cycle_count % _flaky_every) == 0;
+    for(uint16_t i = 0; i < _geometry.page_size; i++) {
+        if(_latch_valid[i] && program && !flaky) {
+            _memory[page_base + i] = _latch[i];
+        }
+        if(_latch_valid[i]) flaky = false;
+        _latch_valid[i] = false;
+    }
+    _latch_count = 0;
+    _word_bytes = 0;
+
+    // Write-protected parts accept the next command right away
+    if(!program) return false;
+
+    _busy_until_ns = now_ns + _write_cycle_ns;
+    return true;
+}
+
+EEPROMSimTransport::EEPROMSimTransport(uint32_t clock_hz)
+    : _device_count(0)
+    , _clock_hz(clock_hz)
+    , _time_ns(0) {
+    resetStats();
+}
+
+void EEPROMSimTransport::attach(EEPROMSimDevice* device) {
+    if(_device_count < EEPROM_SIM_MAX_DEVICES) {
+        _devices[_device_count++] = device;
+    }
+}
+
+void EEPROMSimTransport::setClock(uint32_t clock_hz) {
+    _clock_hz = clock_hz;
+}
+
+uint32_t EEPROMSimTransport::getClock() {
+    return _clock_hz;
+}
+
+uint64_t EEPROMSimTransport::getTimeNs() {
+    return _time_ns;
+}
+
+void EEPROMSimTransport::elapse(uint64_t ns) {
+    _time_ns += ns;
+}
+
+const EEPROMSimStats& EEPROMSimTransport::getStats() {
+    return _stats;
+}
+
+void EEPROMSimTransport::resetStats() {
+    memset(&_stats, 0, sizeof(_stats));
+}
+
+EEPROMSimDevice* EEPROMSimTransport::find(uint8_t address) {
+    for(uint8_t i = 0; i < _device_count; i++) {
+        if(_devices[i]->respondsTo(address)) return _devices[i];
+    }
+    return nullptr;
+}
+
+void EEPROMSimTransport::clockBits(uint32_t bits) {
+    uint64_t ns = static_cast<uint64_t>(bits) * 1000000000ULL / _clock_hz;
+    _time_ns += ns;
+    _stats.bus_ns += ns;
+}
+
+EEPROMSimDevice* EEPROMSimTransport::addressPhase(uint8_t address) {
+    _stats.transactions++;
+    clockBits(SIM_BITS_START + SIM_BITS_BYTE);
+
+    EEPROMSimDevice* device = find(address);
+    if(device == nullptr || device->isBusy(_time_ns)) {
+        // Master gives up with a STOP
+        _stats.nacks++;
+        clockBits(SIM_BITS_STOP);
+        return nullptr;
+    }
+
+    return device;
+}
+
+void EEPROMSimTransport::acquire() {
+    _stats.acquires++;
+}
+
+void EEPROMSimTransport::release() {
+}
+
+bool EEPROMSimTransport::tx(
+    uint8_t address,
+    const uint8_t* data,
+    size_t size,
+    EEPROMBusBegin begin,
+    EEPROMBusEnd end,
+    uint32_t timeout) {
+    (void)begin;
+    (void)timeout;
+
+    EEPROMSimDevice* device = addressPhase(address);
+    if(device == nullptr) return false;
+
+    device->beginWrite(address);
+    for(size_t i = 0; i < size; i++) {
+        clockBits(SIM_BITS_BYTE);
+        device->writeByte(data[i]);
+    }
+    _stats.bytes += size;
+
+    if(end == EEPROMBusEndStop) {
+        clockBits(SIM_BITS_STOP);
+        if(device->stop(_time_ns)) {
+            _stats.write_cycles++;
+        }
+    }
+
+    return true;
+}
+
+bool EEPROMSimTransport::rx(
+    uint8_t address,
+    uint8_t* data,
+    size_t size,
+    EEPROMBusBegin begin,
+    EEPROMBusEnd end,
+    uint32_t timeout) {
+    (void)begin;
+    (void)timeout;
+
+    EEPROMSimDevice* device = addressPhase(address);
+    if(device == nullptr) return false;
+
+    // Reads continue from the internal address counter
+    for(size_t i = 0; i < size; i++) {
+        clockBits(SIM_BITS_BYTE);
+        data[i] = device->readByte();
+    }
+    _stats.bytes += size;
+
+    if(end == EEPROMBusEndStop) {
+        clockBits(SIM_BITS_STOP);
+    }
+
+    return true;
+}
+
+bool EEPROMSimTransport::isDeviceReady(uint8_t address, uint32_t timeout) {
+    (void)timeout;
+
+    _stats.polls++;
+    EEPROMSimDevice* device = addressPhase(address);
+    if(device == nullptr) return false;
+
+    clockBits(SIM_BITS_STOP);
+    return true;
+}
+
+uint32_t EEPROMSimTransport::getTick() {
+    return static_cast<uint32_t>(_time_ns / 1000000ULL);
+}
@@ -0,0 +1,126 @@
+#pragma once
+
+#include "../i2c_24c02.hpp"
+
+// Up to 8 chips share A0-A2 on one bus
+#define EEPROM_SIM_MAX_DEVICES 8
+
+// Simulated 24Cxx part
+// Models page latch wraparound, block select bits in the device address,
+// NACKs while the internal write cycle (tWR) runs and the write-protect pin
+class EEPROMSimDevice {
+private:
+    EEPROMGeometry _geometry;
+    uint8_t _i2c_addr_8bit;
+    uint8_t* _memory;
+    uint32_t _pointer; // Internal address counter
+    uint8_t _word_bytes; // Word address bytes received in current write
+    uint8_t _latch[EEPROM_MAX_PAGE_SIZE];
+    bool _latch_valid[EEPROM_MAX_PAGE_SIZE];
+    uint16_t _latch_count;
+    uint64_t _busy_until_ns;
+    uint32_t _write_cycle_ns;
+    bool _write_protect;
+    uint32_t _flaky_every;
+    uint32_t _write_cycle_count;
+
+public:
+    EEPROMSimDevice(const EEPROMGeometry& geometry, uint8_t i2c_address_7bit);
+    ~EEPROMSimDevice();
+
+    // Chip contents, size bytes
+    uint8_t* memory();
+    uint32_t size();
+
+    // Actual write cycle time (defaults to datasheet maximum)
+    void setWriteCycleTime(uint32_t write_cycle_us);
+
+    // WP pin high: writes are acknowledged but never programmed
+    void setWriteProtect(bool write_protect);
+
+    // Every n-th write cycle leaves the first byte of its page unprogrammed (0 = never)
+    void setFlakyWrites(uint32_t every);
+
+    // Device address match, ignoring block select bits (8-bit address)
+    bool respondsTo(uint8_t address);
+
+    // Internal write cycle still running
+    bool isBusy(uint64_t now_ns);
+
+    // Bus side, driven by EEPROMSimTransport
+    void beginWrite(uint8_t address);
+    void writeByte(uint8_t data);
+    uint8_t readByte();
+
+    // STOP condition, returns true if a write cycle started
+    bool stop(uint64_t now_ns);
+};
+
+// Bus statistics
+typedef struct {
+    uint64_t bus_ns; // Modeled time the bus was driven
+    uint32_t transactions; // START to STOP/restart transfers, polls included
+    uint32_t bytes; // Bytes moved after the device address
+    uint32_t polls; // Address-only probes
+    uint32_t nacks; // Address NACKs
+    uint32_t write_cycles; // Internal write cycles started
+    uint32_t acquires; // Bus lock round-trips
+} EEPROMSimStats;
+
+// Simulated I2C bus with a clock driving modeled time
+class EEPROMSimTransport : public EEPROMTransport {
+private:
+    EEPROMSimDevice* _devices[EEPROM_SIM_MAX_DEVICES];
+    uint8_t _device_count;
+    uint32_t _clock_hz;
+    uint64_t _time_ns;
+    EEPROMSimStats _stats;
+
+    EEPROMSimDevice* find(uint8_t address);
+
+    // Advance modeled time by bus bit periods
+    void clockBits(uint32_t bits);
+
+    // START and address byte, returns the device if it ACKs
+    EEPROMSimDevice* addressPhase(uint8_t address);
+
+public:
+    EEPROMSimTransport(uint32_t clock_hz = EEPROM_BUS_CLOCK_STANDARD);
+
+    void attach(EEPROMSimDevice* device);
+
+    void setClock(uint32_t clock_hz) override;
+    uint32_t getClock() override;
+
+    // Modeled time since start
+    uint64_t getTimeNs();
+
+    // Time spent off the bus (e.g. SD card reads), write cycles keep running
+    void elapse(uint64_t ns);
+
+    const EEPROMSimStats& getStats();
+    void resetStats();
+
+    void acquire() override;
+    void release() override;
+
+    bool tx(
+        uint8_t address,
+        const uint8_t* data,
+        size_t size,
+        EEPROMBusBegin begin,
+        EEPROMBusEnd end,
+        uint32_t timeout) override;
+
+    bool rx(
+        uint8_t address,
+        uint8_t* data,
+        size_t size,
+        EEPROMBusBegin begin,
+        EEPROMBusEnd end,
+        uint32_t timeout) override;
+
+    bool isDeviceReady(uint8_t address, uint32_t timeout) override;
+
+    uint32_t getTick() override;
+};
@@ -0,0 +1,640 @@
+// 24cxxprog_sim - run the programmer operations against a simulated 24Cxx part
+#include "i2c_24c02_sim.hpp"
+#include "../i2c_24c02_chips.hpp"
+#include "../i2c_24c02_ops.hpp"
+#include "../i2c_24c02_cache.hpp"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+typedef struct {
+    EEPROMSimTransport* transport;
+    EEPROMSimDevice* device; // First chip, the one single-chip commands use
+    EEPROMSimDevice* chips[EEPROM_GANG_MAX];
+    uint8_t chip_count;
+    EEPROM24C02* eeprom;
+    bool smart_write;
+    uint32_t range_start; // Chip bytes dump, erase and the file commands work on
+    uint32_t range_length;
+    uint32_t file_offset; // File byte that goes to range_start
+} SimApp;
+
+static void usage() {
+    fprintf(
+        stderr,
+        "usage: 24cxxprog_sim [options] <chip> <command>...\n"
+        "options:\n"
+        "  --clock <hz>    bus clock (default 100000)\n"
+        "  --twr <us>      actual write cycle time (default chip maximum)\n"
+        "  --image <file>  initial chip contents (default blank)\n"
+        "  --chips <n>     identical chips on the bus, 1-8 (default 1)\n"
+        "  --wp            hold write-protect pin of the first chip high\n"
+        "  --flaky <n>     every n-th write cycle drops a byte\n"
+        "  --no-smart      write every page, even if it already matches\n"
+        "  --range <s>:<n> limit dump, erase and file commands to n bytes from s\n"
+        "  --offset <n>    file byte restore, verify and gang start from (default 0)\n"
+        "commands:\n"
+        "  read            bulk read of whole chip\n"
+        "  restore <file>  write file, reading back each page (like Load on device)\n"
+        "  verify <file>   compare chip with file, by CRC when <file>.crc32 exists\n"
+        "  dump <file>     save chip to file and its CRC32 to <file>.crc32\n"
+        "  erase           fill chip with 0xFF\n"
+        "  search <hex>    list matches of a pattern such as DEAD??EF, ?? is any byte\n"
+        "  edit <edits>    commit byte edits like 10=AB,11=CD (hex) page by page\n"
+        "  browse          scroll the Read screen's page cache down the chip and back\n"
+        "  detect          identify chip geometry, check it and that memory is intact\n"
+        "  gang <file>     write and verify file on every chip at once\n"
+        "chips: 24C01 24C02 24C04 24C08 24C16 24C32 24C64 24C128 24C256 24C512\n");
+}
+
+// Chip type from its name like 24C256
+static bool parse_chip(const char* name, EEPROMType* type) {
+    for(int i = 0; i < EEPROMType_Count; i++) {
+        if(strcasecmp(name, eeprom_chip_traits[i].name) == 0) {
+            *type = static_cast<EEPROMType>(i);
+            return true;
+        }
+    }
+    return false;
+}
+
+static const char* result_name(EEPROMOpResult result) {
+    switch(result) {
+    case EEPROMOpOk:
+        return "OK";
+    case EEPROMOpCancelled:
+        return "cancelled";
+    case EEPROMOpReadError:
+        return "read error";
+    case EEPROMOpWriteError:
+        return "write error";
+    case EEPROMOpSourceError:
+        return "file read error";
+    case EEPROMOpSinkError:
+        return "file write error";
+    case EEPROMOpMismatch:
+        return "mismatch";
+    case EEPROMOpNotFound:
+        return "not found";
+    case EEPROMOpNoMemory:
+        return "out of memory";
+    }
+    return "?";
+}
+
+static bool file_source_read(void* context, uint8_t* buffer, uint32_t length) {
+    return fread(buffer, 1, length, static_cast<FILE*>(context)) == length;
+}
+
+// Dump sink writing straight to a stdio file
+typedef struct {
+    FILE* file;
+    uint8_t buffer[EEPROM_OP_DUMP_CHUNK];
+} FileSink;
+
+static uint8_t* file_sink_acquire(void* context) {
+    return static_cast<FileSink*>(context)->buffer;
+}
+
+static bool file_sink_submit(void* context, uint8_t* buffer, uint32_t length) {
+    return fwrite(buffer, 1, length, static_cast<FileSink*>(context)->file) == length;
+}
+
+// Open input at the file offset and clamp stream length to both file and range
+static FILE* open_input(const SimApp* sim, const char* path, uint32_t* length) {
+    FILE* file = fopen(path, "rb");
+    if(file == nullptr) return nullptr;
+
+    fseek(file, 0, SEEK_END);
+    long available = ftell(file) - (long)sim->file_offset;
+    if(available <= 0) {
+        fclose(file);
+        return nullptr;
+    }
+    fseek(file, sim->file_offset, SEEK_SET);
+
+    *length = (available < (long)sim->range_length) ? (uint32_t)available : sim->range_length;
+    return file;
+}
+
+static void report(SimApp* sim, const char* command, EEPROMOpResult result) {
+    const EEPROMSimStats& stats = sim->transport->getStats();
+    printf(
+        "%-8s %-16s bus %9.2f ms  %6u transactions  %6u polls  %5u write cycles\n",
+        command,
+        result_name(result),
+        stats.bus_ns / 1e6,
+        stats.transactions,
+        stats.polls,
+        stats.write_cycles);
+}
+
+static EEPROMOpResult run_restore(SimApp* sim, const char* path) {
+    uint32_t length;
+    FILE* file = open_input(sim, path, &length);
+    if(file == nullptr) return EEPROMOpSourceError;
+
+    EEPROMWriteStats stats;
+    EEPROMOpResult result = eeprom_op_write(
+        sim->eeprom,
+        sim->range_start,
+        length,
+        file_source_read,
+        file,
+        sim->smart_write,
+        true,
+        nullptr,
+        nullptr,
+        &stats);
+    fclose(file);
+
+    printf(
+        "         %u pages written, %u skipped, %u rewritten, file CRC32 %08X\n",
+        stats.pages_written,
+        stats.pages_skipped,
+        stats.pages_retried,
+        stats.crc);
+    printf(
+        "         %u driver ACK polls, at most %u for one page\n",
+        stats.ack_polls,
+        stats.max_page_polls);
+    if(stats.bytes_failed > 0) {
+        printf("         %u bytes wrong:", stats.bytes_failed);
+        for(uint32_t i = 0; i < stats.bytes_failed && i < EEPROM_OP_FAILED_REPORT; i++) {
+            printf(" 0x%04X", stats.failed_addresses[i]);
+        }
+        printf("\n");
+    }
+    return result;
+}
+
+static EEPROMOpResult run_gang(SimApp* sim, const char* path) {
+    uint32_t length;
+    FILE* file = open_input(sim, path, &length);
+    if(file == nullptr) return EEPROMOpSourceError;
+
+    EEPROMGang gang;
+    gang.count = sim->chip_count;
+    for(uint8_t i = 0; i < gang.count; i++) {
+        gang.addresses[i] = EEPROM_24C02_BASE_ADDR + (i << sim->eeprom->getGeometry().block_bits);
+        gang.results[i] = EEPROMOpOk;
+    }
+
+    uint64_t start_ns = sim->transport->getTimeNs();
+    EEPROMWriteStats stats;
+    EEPROMOpResult result = eeprom_op_gang_write(
+        sim->eeprom,
+        &gang,
+        sim->range_start,
+        length,
+        file_source_read,
+        file,
+        sim->smart_write,
+        nullptr,
+        &stats);
+    if(result == EEPROMOpOk || result == EEPROMOpWriteError) {
+        fseek(file, sim->file_offset, SEEK_SET);
+        result = eeprom_op_gang_verify(
+            sim->eeprom, &gang, sim->range_start, length, file_source_read, file, nullptr);
+    }
+    fclose(file);
+
+    printf(
+        "         %u pages written, %u skipped, %u driver ACK polls, %.2f ms elapsed\n",
+        stats.pages_written,
+        stats.pages_skipped,
+        stats.ack_polls,
+        (sim->transport->getTimeNs() - start_ns) / 1e6);
+    for(uint8_t i = 0; i < gang.count; i++) {
+        printf("         0x%02X %s\n", gang.addresses[i], result_name(gang.results[i]));
+    }
+    return result;
+}
+
+// Checksum file next to path, written by dump
+static void checksum_path(const char* path, char* buffer, size_t buffer_size) {
+    snprintf(buffer, buffer_size, "%s" EEPROM_CRC32_SUFFIX, path);
+}
+
+static bool load_checksum(const char* path, uint32_t* crc, uint32_t* length) {
+    char crc_path[512];
+    checksum_path(path, crc_path, sizeof(crc_path));
+    FILE* file = fopen(crc_path, "r");
+    if(file == nullptr) return false;
+
+    char record[EEPROM_CRC32_RECORD_SIZE];
+    bool loaded = fgets(record, sizeof(record), file) &&
+                  eeprom_crc32_record_parse(record, crc, length);
+    fclose(file);
+    return loaded;
+}
+
+static EEPROMOpResult run_verify(SimApp* sim, const char* path) {
+    uint32_t length;
+    FILE* file = open_input(sim, path, &length);
+    if(file == nullptr) return EEPROMOpSourceError;
+
+    // Stored checksum: one chip read pass, the file is only read if it differs
+    EEPROMVerifyStats stats;
+    EEPROMOpResult result = EEPROMOpMismatch;
+    uint32_t crc, crc_length;
+    if(sim->file_offset == 0 && load_checksum(path, &crc, &crc_length) &&
+       crc_length == length) {
+        result = eeprom_op_verify_crc(
+            sim->eeprom, sim->range_start, length, crc, nullptr, nullptr, &stats);
+        printf("         chip CRC32 %08X, stored %08X\n", stats.crc, crc);
+    }
+    if(result == EEPROMOpMismatch) {
+        result = eeprom_op_verify(
+            sim->eeprom,
+            sim->range_start,
+            length,
+            file_source_read,
+            file,
+            nullptr,
+            nullptr,
+            &stats);
+        if(stats.bytes_differ > 0) {
+            printf(
+                "         %u bytes differ, first at 0x%04X\n",
+                stats.bytes_differ,
+                stats.first_difference);
+        }
+    }
+    fclose(file);
+    return result;
+}
+
+static EEPROMOpResult run_dump(SimApp* sim, const char* path) {
+    FileSink* sink_data = static_cast<FileSink*>(malloc(sizeof(FileSink)));
+    sink_data->file = fopen(path, "wb");
+    if(sink_data->file == nullptr) {
+        free(sink_data);
+        return EEPROMOpSinkError;
+    }
+
+    EEPROMDumpSink sink;
+    sink.acquire = file_sink_acquire;
+    sink.submit = file_sink_submit;
+    sink.context = sink_data;
+    uint32_t crc;
+    EEPROMOpResult result =
+        eeprom_op_dump(sim->eeprom, sim->range_start, sim->range_length, &sink, &crc, nullptr);
+
+    if(fclose(sink_data->file) != 0 && result == EEPROMOpOk) result = EEPROMOpSinkError;
+    free(sink_data);
+
+    // Checksum goes next to the dump, like on the device
+    if(result == EEPROMOpOk) {
+        char crc_path[512];
+        char record[EEPROM_CRC32_RECORD_SIZE];
+        size_t record_length =
+            eeprom_crc32_record_format(record, sizeof(record), crc, sim->range_length);
+        checksum_path(path, crc_path, sizeof(crc_path));
+        FILE* file = fopen(crc_path, "w");
+        if(file == nullptr || fwrite(record, 1, record_length, file) != record_length) {
+            result = EEPROMOpSinkError;
+        }
+        if(file && fclose(file) != 0) result = EEPROMOpSinkError;
+        printf("         CRC32 %08X\n", crc);
+    }
+    return result;
+}
+
+static EEPROMOpResult run_read(SimApp* sim) {
+    uint8_t* buffer = static_cast<uint8_t*>(malloc(sim->device->size()));
+    bool success = sim->eeprom->readSequential(0, buffer, sim->device->size());
+    free(buffer);
+    return success ? EEPROMOpOk : EEPROMOpReadError;
+}
+
+static EEPROMOpResult run_erase(SimApp* sim) {
+    EEPROMEraseStats stats;
+    EEPROMOpResult result =
+        eeprom_op_erase(sim->eeprom, sim->range_start, sim->range_length, nullptr, &stats);
+    printf("         %u pages erased, %u skipped\n", stats.pages_erased, stats.pages_skipped);
+    return result;
+}
+
+// Every match, each search resuming one byte past the previous one
+static EEPROMOpResult run_search(SimApp* sim, const char* text) {
+    EEPROMPattern pattern;
+    if(!eeprom_pattern_parse(&pattern, text)) return EEPROMOpSourceError;
+
+    uint32_t size = sim->device->size();
+    uint32_t from = 0;
+    uint32_t matches = 0;
+    EEPROMOpResult result = EEPROMOpOk;
+    while(from < size) {
+        uint32_t match;
+        result =
+            eeprom_op_search(sim->eeprom, from, size - from, &pattern, false, &match, nullptr);
+        if(result != EEPROMOpOk) break;
+        printf("         match at 0x%04X\n", match);
+        matches++;
+        from = match + 1;
+    }
+    printf("         %u matches\n", matches);
+    return (result == EEPROMOpNotFound && matches > 0) ? EEPROMOpOk : result;
+}
+
+// Read the missing or stale cache pages of a range, like the viewer's fetch
+static bool browse_fetch(SimApp* sim, EEPROMPageCache* cache, uint32_t start, uint32_t length) {
+    // Each page of the range is read at most once, more means the cache lost one
+    uint32_t budget = length / EEPROM_CACHE_PAGE_SIZE + 2;
+    uint8_t page[EEPROM_CACHE_PAGE_SIZE];
+    uint32_t base;
+    while(eeprom_cache_next_missing(cache, start, length, &base)) {
+        if(budget-- == 0 || !sim->eeprom->readBytes(base, page, EEPROM_CACHE_PAGE_SIZE)) {
+            return false;
+        }
+        eeprom_cache_store(cache, base, page);
+    }
+    return true;
+}
+
+// Cached bytes of a range must be fresh and equal the chip
+static bool browse_check(SimApp* sim, EEPROMPageCache* cache, uint32_t start, uint32_t length) {
+    for(uint32_t addr = start; addr < start + length; addr++) {
+        bool fresh;
+        const uint8_t* data = eeprom_cache_lookup(cache, addr, &fresh);
+        if(data == nullptr || !fresh ||
+           data[addr % EEPROM_CACHE_PAGE_SIZE] != sim->device->memory()[addr]) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// Scroll a Read screen window down the chip and back through the page cache, prefetching
+// in the scroll direction, then write under it: the written page must turn stale, be read
+// again, and pages scrolled out long ago must have been evicted
+static EEPROMOpResult run_browse(SimApp* sim) {
+    const uint32_t window = 64; // Eight rows of eight bytes
+    const uint32_t ahead = EEPROM_CACHE_PREFETCH * EEPROM_CACHE_PAGE_SIZE;
+    uint32_t size = sim->device->size();
+    uint32_t last = size - window;
+    EEPROMPageCache* cache = static_cast<EEPROMPageCache*>(malloc(sizeof(EEPROMPageCache)));
+    eeprom_cache_reset(cache, size);
+
+    EEPROMOpResult result = EEPROMOpOk;
+    uint32_t rows = 2 * last / 8;
+    for(uint32_t row = 0; result == EEPROMOpOk && row <= rows; row++) {
+        bool down = row * 8 < last;
+        uint32_t position = down ? row * 8 : 2 * last - row * 8;
+        uint32_t start = down ? position : (position > ahead ? position - ahead : 0);
+        if(!browse_fetch(sim, cache, start, window + ahead)) {
+            result = EEPROMOpReadError;
+        } else if(!browse_check(sim, cache, position, window)) {
+            result = EEPROMOpMismatch;
+        }
+    }
+
+    // Back at the top, the far end of the chip no longer fits
+    bool fresh;
+    if(result == EEPROMOpOk && size > EEPROM_CACHE_PAGES * EEPROM_CACHE_PAGE_SIZE &&
+       eeprom_cache_lookup(cache, size - 1, &fresh) != nullptr) {
+        result = EEPROMOpMismatch;
+    }
+
+    // A write under the window leaves exactly its page to read again
+    uint32_t written = window / 2;
+    uint32_t missing;
+    if(result == EEPROMOpOk &&
+       !sim->eeprom->writeByte(written, ~sim->device->memory()[written])) {
+        result = EEPROMOpWriteError;
+    }
+    if(result == EEPROMOpOk) {
+        eeprom_cache_invalidate(cache, written, 1);
+        if(!eeprom_cache_next_missing(cache, 0, window, &missing) ||
+           missing != written - written % EEPROM_CACHE_PAGE_SIZE ||
+           eeprom_cache_lookup(cache, written, &fresh) == nullptr || fresh) {
+            result = EEPROMOpMismatch;
+        } else if(!browse_fetch(sim, cache, 0, window)) {
+            result = EEPROMOpReadError;
+        } else if(!browse_check(sim, cache, 0, window)) {
+            result = EEPROMOpMismatch;
+        }
+    }
+    free(cache);
+    return result;
+}
+
+// Byte edits committed the way the device editor does it
+static EEPROMOpResult run_edit(SimApp* sim, const char* text) {
+    EEPROMEditBuffer* edits = static_cast<EEPROMEditBuffer*>(malloc(sizeof(EEPROMEditBuffer)));
+    eeprom_edit_reset(edits, sim->device->size(), sim->eeprom->getGeometry().page_size);
+
+    EEPROMOpResult result = EEPROMOpOk;
+    while(*text) {
+        char* end;
+        unsigned long address = strtoul(text, &end, 16);
+        if(*end != '=') {
+            result = EEPROMOpSourceError;
+            break;
+        }
+        text = end + 1;
+        unsigned long value = strtoul(text, &end, 16);
+        if(end == text || value > 0xFF || !eeprom_edit_set(edits, address, value)) {
+            result = EEPROMOpSourceError;
+            break;
+        }
+        text = (*end == ',') ? end + 1 : end;
+    }
+
+    if(result == EEPROMOpOk) {
+        printf(
+            "         %u bytes in %u pages\n",
+            edits->count,
+            (unsigned)eeprom_edit_dirty_pages(edits));
+        EEPROMWriteStats stats;
+        result = eeprom_op_commit(sim->eeprom, edits, nullptr, &stats);
+        printf(
+            "         %u pages written, %u unchanged, %u bytes failed, at most %u polls/page\n",
+            stats.pages_written,
+            stats.pages_skipped,
+            stats.bytes_failed,
+            stats.max_page_polls);
+    }
+    free(edits);
+    return result;
+}
+
+static EEPROMOpResult run_detect(SimApp* sim) {
+    uint32_t size = sim->device->size();
+    uint8_t* before = static_cast<uint8_t*>(malloc(size));
+    memcpy(before, sim->device->memory(), size);
+
+    EEPROMGeometry detected;
+    EEPROMOpResult result = EEPROMOpReadError;
+    if(sim->eeprom->detectGeometry(detected)) {
+        const EEPROMGeometry& actual = sim->eeprom->getGeometry();
+        printf(
+            "         %u bytes, %u byte pages, %u address bytes, %u block bits\n",
+            (unsigned)detected.size,
+            detected.page_size,
+            detected.address_bytes,
+            detected.block_bits);
+
+        bool match = detected.size == actual.size && detected.page_size == actual.page_size &&
+                     detected.address_bytes == actual.address_bytes &&
+                     detected.block_bits == actual.block_bits;
+        result = (match && memcmp(before, sim->device->memory(), size) == 0) ? EEPROMOpOk :
+                                                                               EEPROMOpMismatch;
+    }
+
+    free(before);
+    return result;
+}
+
+static bool load_image(EEPROMSimDevice* device, const char* path) {
+    FILE* file = fopen(path, "rb");
+    if(file == nullptr) return false;
+    fread(device->memory(), 1, device->size(), file);
+    fclose(file);
+    return true;
+}
+
+int main(int argc, char** argv) {
+    uint32_t clock_hz = 100000;
+    long write_cycle_us = -1;
+    const char* image_path = nullptr;
+    bool write_protect = false;
+    bool smart_write = true;
+    long chip_count = 1;
+    uint32_t flaky_every = 0;
+    uint32_t range_start = 0;
+    uint32_t range_length = 0; // Rest of the chip
+    uint32_t file_offset = 0;
+
+    int arg = 1;
+    for(; arg < argc && strncmp(argv[arg], "--", 2) == 0; arg++) {
+        if(strcmp(argv[arg], "--clock") == 0 && arg + 1 < argc) {
+            clock_hz = strtoul(argv[++arg], nullptr, 0);
+        } else if(strcmp(argv[arg], "--twr") == 0 && arg + 1 < argc) {
+            write_cycle_us = strtol(argv[++arg], nullptr, 0);
+        } else if(strcmp(argv[arg], "--image") == 0 && arg + 1 < argc) {
+            image_path = argv[++arg];
+        } else if(strcmp(argv[arg], "--chips") == 0 && arg + 1 < argc) {
+            chip_count = strtol(argv[++arg], nullptr, 0);
+        } else if(strcmp(argv[arg], "--flaky") == 0 && arg + 1 < argc) {
+            flaky_every = strtoul(argv[++arg], nullptr, 0);
+        } else if(strcmp(argv[arg], "--wp") == 0) {
+            write_protect = true;
+        } else if(strcmp(argv[arg], "--no-smart") == 0) {
+            smart_write = false;
+        } else if(strcmp(argv[arg], "--range") == 0 && arg + 1 < argc) {
+            char* end;
+            range_start = strtoul(argv[++arg], &end, 0);
+            if(*end != ':') {
+                usage();
+                return 2;
+            }
+            range_length = strtoul(end + 1, nullptr, 0);
+        } else if(strcmp(argv[arg], "--offset") == 0 && arg + 1 < argc) {
+            file_offset = strtoul(argv[++arg], nullptr, 0);
+        } else {
+            usage();
+            return 2;
+        }
+    }
+
+    EEPROMType chip_type;
+    if(arg >= argc || clock_hz == 0 || !parse_chip(argv[arg], &chip_type)) {
+        usage();
+        return 2;
+    }
+    arg++;
+
+    // Block select chips take 2/4/8 addresses each
+    const EEPROMGeometry& geometry = get_eeprom_geometry(chip_type);
+    if(chip_count < 1 || (chip_count << geometry.block_bits) > EEPROM_GANG_MAX) {
+        fprintf(
+            stderr,
+            "at most %d %s chips fit on one bus\n",
+            EEPROM_GANG_MAX >> geometry.block_bits,
+            argv[arg - 1]);
+        return 2;
+    }
+    if(range_start >= geometry.size || range_length > geometry.size - range_start) {
+        fprintf(stderr, "range does not fit the %s\n", argv[arg - 1]);
+        return 2;
+    }
+    if(range_length == 0) range_length = geometry.size - range_start;
+
+    EEPROMSimTransport transport(clock_hz);
+    SimApp sim;
+    sim.chip_count = chip_count;
+    for(uint8_t i = 0; i < sim.chip_count; i++) {
+        EEPROMSimDevice* device =
+            new EEPROMSimDevice(geometry, EEPROM_24C02_BASE_ADDR + (i << geometry.block_bits));
+        if(write_cycle_us >= 0) device->setWriteCycleTime(write_cycle_us);
+        device->setWriteProtect(write_protect && i == 0);
+        device->setFlakyWrites(flaky_every);
+        if(image_path && !load_image(device, image_path)) {
+            fprintf(stderr, "cannot open %s\n", image_path);
+            return 1;
+        }
+        transport.attach(device);
+        sim.chips[i] = device;
+    }
+
+    EEPROM24C02 eeprom(&transport, EEPROM_24C02_BASE_ADDR);
+    eeprom.setGeometry(geometry);
+    eeprom.setWriteCycleTimeout(geometry.write_cycle_ms * 2);
+
+    sim.transport = &transport;
+    sim.device = sim.chips[0];
+    sim.eeprom = &eeprom;
+    sim.smart_write = smart_write;
+    sim.range_start = range_start;
+    sim.range_length = range_length;
+    sim.file_offset = file_offset;
+
+    bool failed = false;
+    for(; arg < argc; arg++) {
+        const char* command = argv[arg];
+        const char* path = (arg + 1 < argc) ? argv[arg + 1] : nullptr;
+        EEPROMOpResult result;
+
+        transport.resetStats();
+        if(strcmp(command, "read") == 0) {
+            result = run_read(&sim);
+        } else if(strcmp(command, "erase") == 0) {
+            result = run_erase(&sim);
+        } else if(strcmp(command, "browse") == 0) {
+            result = run_browse(&sim);
+        } else if(strcmp(command, "detect") == 0) {
+            result = run_detect(&sim);
+        } else if(path && strcmp(command, "restore") == 0) {
+            result = run_restore(&sim, path);
+            arg++;
+        } else if(path && strcmp(command, "verify") == 0) {
+            result = run_verify(&sim, path);
+            arg++;
+        } else if(path && strcmp(command, "gang") == 0) {
+            result = run_gang(&sim, path);
+            arg++;
+        } else if(path && strcmp(command, "edit") == 0) {
+            result = run_edit(&sim, path);
+            arg++;
+        } else if(path && strcmp(command, "search") == 0) {
+            result = run_search(&sim, path);
+            arg++;
+        } else if(path && strcmp(command, "dump") == 0) {
+            result = run_dump(&sim, path);
+            arg++;
+        } else {
+            usage();
+            return 2;
+        }
+
+        report(&sim, command, result);
+        if(result != EEPROMOpOk) failed = true;
+    }
+
+    for(uint8_t i = 0; i < sim.chip_count; i++) {
+        delete sim.chips[i];
+    }
+    return failed ? 1 : 0;
+}
@@ -1,9 +1,47 @@
 #include "i2c_24c02.hpp"
-#include "furi_hal_i2c.h"
-#include <furi.h>
+#include <stdlib.h>
+#include <string.h>
 
-EEPROM24C02::EEPROM24C02(uint8_t i2c_address_7bit)
-    : _i2c_addr_8bit(i2c_address_7bit << 1) {
+// Timeout for a transfer of given length (~90us per byte at 100kHz)
+static uint32_t transferTimeout(uint32_t length) {
+    return EEPROM_I2C_TIMEOUT + length / 8;
+}
+
+EEPROM24C02::EEPROM24C02(EEPROMTransport* transport, uint8_t i2c_address_7bit)
+    : _transport(transport)
+    , _i2c_addr_8bit(i2c_address_7bit << 1)
+    , _write_cycle_timeout(EEPROM_WRITE_CYCLE_TIMEOUT)
+    , _last_poll_count(0)
+    , _session_depth(0) {
+    setGeometry(get_eeprom_geometry(EEPROMType_24C02));
+}
+
+EEPROMBusSession::EEPROMBusSession(EEPROM24C02& eeprom)
+    : _eeprom(eeprom) {
+    _eeprom.busAcquire();
+}
+
+EEPROMBusSession::~EEPROMBusSession() {
+    _eeprom.busRelease();
+}
+
+void EEPROMBusSession::yield() {
+    if(_eeprom._session_depth == 1) {
+        _eeprom._transport->release();
+        _eeprom._transport->acquire();
+    }
+}
+
+void EEPROM24C02::busAcquire() {
+    if(_session_depth++ == 0) {
+        _transport->acquire();
+    }
+}
+
+void EEPROM24C02::busRelease() {
+    if(--_session_depth == 0) {
+        _transport->release();
+    }
 }
 
 bool EEPROM24C02::init() {
@@ -11,155 +49,324 @@ bool EEPROM24C02::init() {
     return isAvailable();
 }
 
-bool EEPROM24C02::isAvailable() {
-    furi_hal_i2c_acquire(&furi_hal_i2c_handle_external);
+void EEPROM24C02::setGeometry(const EEPROMGeometry& geometry) {
+    _geometry = geometry;
+    if(_geometry.page_size == 0 || _geometry.page_size > EEPROM_MAX_PAGE_SIZE) {
+        _geometry.page_size = EEPROM_MAX_PAGE_SIZE;
+    }
+    selectHotLoops();
+}
 
-    // Try to read a dummy byte to check if device responds
-    uint8_t dummy_data;
-    bool success = furi_hal_i2c_rx(
-        &furi_hal_i2c_handle_external, _i2c_addr_8bit, &dummy_data, 1, EEPROM_I2C_TIMEOUT);
+void EEPROM24C02::selectHotLoops() {
+    // Page sizes of the chip table get their own loop, anything else
+    // (e.g. a detected vendor variant) runs the generic one
+    if(_geometry.address_bytes == 2) {
+        _sequential_read = &EEPROM24C02::sequentialRead<2>;
+        switch(_geometry.page_size) {
+        case 32:
+            _page_write = &EEPROM24C02::pageWrite<2, 32>;
+            break;
+        case 64:
+            _page_write = &EEPROM24C02::pageWrite<2, 64>;
+            break;
+        case 128:
+            _page_write = &EEPROM24C02::pageWrite<2, 128>;
+            break;
+        default:
+            _page_write = &EEPROM24C02::pageWrite<2, 0>;
+            break;
+        }
+    } else {
+        _sequential_read = &EEPROM24C02::sequentialRead<1>;
+        switch(_geometry.page_size) {
+        case 8:
+            _page_write = &EEPROM24C02::pageWrite<1, 8>;
+            break;
+        case 16:
+            _page_write = &EEPROM24C02::pageWrite<1, 16>;
+            break;
+        default:
+            _page_write = &EEPROM24C02::pageWrite<1, 0>;
+            break;
+        }
+    }
+}
 
-    furi_hal_i2c_release(&furi_hal_i2c_handle_external);
+const EEPROMGeometry& EEPROM24C02::getGeometry() {
+    return _geometry;
+}
 
-    return success;
+// Word address of fixed width, MSB first
+template <uint8_t AddressBytes>
+static inline uint8_t encodeWordAddress(uint32_t memory_addr, uint8_t* buffer) {
+    if(AddressBytes == 2) {
+        buffer[0] = (memory_addr >> 8) & 0xFF;
+        buffer[1] = memory_addr & 0xFF;
+    } else {
+        buffer[0] = memory_addr & 0xFF;
+    }
+    return AddressBytes;
+}
+
+uint8_t EEPROM24C02::deviceAddress(uint32_t memory_addr) {
+    // 24C04/08/16 take address bits above the word address in A0-A2
+    uint8_t block = (memory_addr >> 8) & ((1 << _geometry.block_bits) - 1);
+    return _i2c_addr_8bit | (block << 1);
+}
+
+uint8_t EEPROM24C02::encodeAddress(uint32_t memory_addr, uint8_t* buffer) {
+    if(_geometry.address_bytes == 2) {
+        buffer[0] = (memory_addr >> 8) & 0xFF;
+        buffer[1] = memory_addr & 0xFF;
+        return 2;
+    }
+
+    buffer[0] = memory_addr & 0xFF;
+    return 1;
+}
+
+uint32_t EEPROM24C02::segmentRemaining(uint32_t memory_addr) {
+    if(_geometry.block_bits == 0) {
+        return _geometry.size - memory_addr;
+    }
+
+    return 256 - (memory_addr & 0xFF);
 }
 
-bool EEPROM24C02::readByte(uint8_t memory_addr, uint8_t& data) {
-    furi_hal_i2c_acquire(&furi_hal_i2c_handle_external);
+bool EEPROM24C02::isAvailable() {
+    EEPROMBusSession session(*this);
 
-    // Send memory address first
-    bool success_tx = furi_hal_i2c_tx_ext(
-        &furi_hal_i2c_handle_external,
+    // Try to read a dummy byte to check if device responds
+    uint8_t dummy_data;
+    return _transport->rx(
         _i2c_addr_8bit,
-        false,
-        &memory_addr,
+        &dummy_data,
         1,
-        FuriHalI2cBeginStart,
-        FuriHalI2cEndAwaitRestart,
+        EEPROMBusBeginStart,
+        EEPROMBusEndStop,
         EEPROM_I2C_TIMEOUT);
+}
 
-    // Read the data
-    bool success_rx = false;
-    if(success_tx) {
-        success_rx = furi_hal_i2c_rx_ext(
-            &furi_hal_i2c_handle_external,
-            _i2c_addr_8bit,
-            false,
-            &data,
-            1,
-            FuriHalI2cBeginRestart,
-            FuriHalI2cEndStop,
-            EEPROM_I2C_TIMEOUT);
-    }
+bool EEPROM24C02::waitWriteComplete() {
+    return waitReady(_i2c_addr_8bit);
+}
 
-    furi_hal_i2c_release(&furi_hal_i2c_handle_external);
+bool EEPROM24C02::waitReady(uint8_t device_addr) {
+    // Device NACKs its address until the internal write cycle is done
+    EEPROMBusSession session(*this);
+    uint32_t start = _transport->getTick();
+    _last_poll_count = 0;
+
+    do {
+        _last_poll_count++;
+
+        if(_transport->isDeviceReady(device_addr, 1)) {
+            return true;
+        }
+    } while(_transport->getTick() - start < _write_cycle_timeout);
 
-    return success_tx && success_rx;
+    return false;
 }
 
-bool EEPROM24C02::writeByte(uint8_t memory_addr, uint8_t data) {
-    uint8_t write_buffer[2];
-    write_buffer[0] = memory_addr;
-    write_buffer[1] = data;
+void EEPROM24C02::setWriteCycleTimeout(uint32_t timeout_ms) {
+    _write_cycle_timeout = timeout_ms;
+}
 
-    furi_hal_i2c_acquire(&furi_hal_i2c_handle_external);
+uint16_t EEPROM24C02::getLastPollCount() {
+    return _last_poll_count;
+}
 
-    bool success = furi_hal_i2c_tx_ext(
-        &furi_hal_i2c_handle_external,
-        _i2c_addr_8bit,
-        false,
-        write_buffer,
-        2,
-        FuriHalI2cBeginStart,
-        FuriHalI2cEndStop,
-        EEPROM_I2C_TIMEOUT);
+bool EEPROM24C02::readByte(uint32_t memory_addr, uint8_t& data) {
+    return readBytes(memory_addr, &data, 1);
+}
 
-    furi_hal_i2c_release(&furi_hal_i2c_handle_external);
+bool EEPROM24C02::writeByte(uint32_t memory_addr, uint8_t data) {
+    return writeBytes(memory_addr, &data, 1);
+}
 
-    if(success) {
-        // Wait for write cycle to complete (typically 5ms for 24C02)
-        furi_delay_ms(10);
+bool EEPROM24C02::readBytes(uint32_t start_addr, uint8_t* buffer, uint32_t length) {
+    if(length == 0 || buffer == nullptr) return false;
+    if(start_addr + length > _geometry.size) return false;
+
+    EEPROMBusSession session(*this);
+    uint32_t bytes_read = 0;
+
+    // Sequential read never crosses a block select boundary
+    while(bytes_read < length) {
+        uint32_t current_addr = start_addr + bytes_read;
+        uint32_t bytes_to_read = segmentRemaining(current_addr);
+        if(bytes_to_read > length - bytes_read) bytes_to_read = length - bytes_read;
+
+        uint8_t addr_buffer[EEPROM_MAX_ADDRESS_BYTES];
+        uint8_t addr_length = encodeAddress(current_addr, addr_buffer);
+        uint8_t device_addr = deviceAddress(current_addr);
+
+        // Send start address
+        bool success = _transport->tx(
+            device_addr,
+            addr_buffer,
+            addr_length,
+            EEPROMBusBeginStart,
+            EEPROMBusEndAwaitRestart,
+            EEPROM_I2C_TIMEOUT);
+
+        // Sequential read
+        if(success) {
+            success = _transport->rx(
+                device_addr,
+                &buffer[bytes_read],
+                bytes_to_read,
+                EEPROMBusBeginRestart,
+                EEPROMBusEndStop,
+                transferTimeout(bytes_to_read));
+        }
+
+        if(!success) {
+            return false;
+        }
+
+        bytes_read += bytes_to_read;
     }
 
-    return success;
+    return true;
 }
 
-bool EEPROM24C02::readBytes(uint8_t start_addr, uint8_t* buffer, uint8_t length) {
+bool EEPROM24C02::readSequential(
+    uint32_t start_addr,
+    uint8_t* buffer,
+    uint32_t length,
+    EEPROMProgressCallback callback,
+    void* context) {
     if(length == 0 || buffer == nullptr) return false;
+    if(start_addr + length > _geometry.size) return false;
 
-    furi_hal_i2c_acquire(&furi_hal_i2c_handle_external);
+    return (this->*_sequential_read)(start_addr, buffer, length, callback, context);
+}
 
-    // Send start address
-    bool success_tx = furi_hal_i2c_tx_ext(
-        &furi_hal_i2c_handle_external,
-        _i2c_addr_8bit,
-        false,
-        &start_addr,
-        1,
-        FuriHalI2cBeginStart,
-        FuriHalI2cEndAwaitRestart,
-        EEPROM_I2C_TIMEOUT);
+template <uint8_t AddressBytes>
+bool EEPROM24C02::sequentialRead(
+    uint32_t start_addr,
+    uint8_t* buffer,
+    uint32_t length,
+    EEPROMProgressCallback callback,
+    void* context) {
+    EEPROMBusSession session(*this);
+    uint32_t bytes_read = 0;
+    uint32_t segment_end = 0;
+
+    while(bytes_read < length) {
+        uint32_t current_addr = start_addr + bytes_read;
+        uint8_t device_addr = deviceAddress(current_addr);
+        uint32_t bytes_to_read = EEPROM_READ_CHUNK_SIZE;
+        if(bytes_to_read > length - bytes_read) bytes_to_read = length - bytes_read;
+
+        bool success;
+        if(bytes_read == 0 || bytes_read == segment_end) {
+            // Addressed read at start and at every block select boundary
+            uint32_t segment = _geometry.size - current_addr;
+            if(AddressBytes == 1 && _geometry.block_bits != 0) {
+                segment = 256 - (current_addr & 0xFF);
+            }
+            segment_end = bytes_read + segment;
+            if(bytes_to_read > segment) bytes_to_read = segment;
+
+            uint8_t addr_buffer[AddressBytes];
+            encodeWordAddress<AddressBytes>(current_addr, addr_buffer);
+
+            success = _transport->tx(
+                device_addr,
+                addr_buffer,
+                AddressBytes,
+                EEPROMBusBeginStart,
+                EEPROMBusEndAwaitRestart,
+                EEPROM_I2C_TIMEOUT);
+
+            if(success) {
+                success = _transport->rx(
+                    device_addr,
+                    &buffer[bytes_read],
+                    bytes_to_read,
+                    EEPROMBusBeginRestart,
+                    EEPROMBusEndStop,
+                    transferTimeout(bytes_to_read));
+            }
+        } else {
+            // Current-address read continues where the last chunk stopped
+            if(bytes_to_read > segment_end - bytes_read) bytes_to_read = segment_end - bytes_read;
+
+            success = _transport->rx(
+                device_addr,
+                &buffer[bytes_read],
+                bytes_to_read,
+                EEPROMBusBeginStart,
+                EEPROMBusEndStop,
+                transferTimeout(bytes_to_read));
+        }
 
-    // Sequential read
-    bool success_rx = false;
-    if(success_tx) {
-        success_rx = furi_hal_i2c_rx_ext(
-            &furi_hal_i2c_handle_external,
-            _i2c_addr_8bit,
-            false,
-            buffer,
-            length,
-            FuriHalI2cBeginRestart,
-            FuriHalI2cEndStop,
-            EEPROM_I2C_TIMEOUT);
-    }
+        if(!success) {
+            return false;
+        }
+
+        bytes_read += bytes_to_read;
 
-    furi_hal_i2c_release(&furi_hal_i2c_handle_external);
+        if(callback) {
+            callback(bytes_read, length, context);
+        }
+    }
 
-    return success_tx && success_rx;
+    return true;
 }
 
-bool EEPROM24C02::writeBytes(uint8_t start_addr, const uint8_t* buffer, uint8_t length) {
+bool EEPROM24C02::writeBytes(uint32_t start_addr, const uint8_t* buffer, uint32_t length) {
     if(length == 0 || buffer == nullptr) return false;
+    if(start_addr + length > _geometry.size) return false;
+
+    return (this->*_page_write)(start_addr, buffer, length, false);
+}
 
-    // 24C02 has 8-byte page size - we need to handle page boundaries
-    uint8_t bytes_written = 0;
+template <uint8_t AddressBytes, uint16_t PageSize>
+bool EEPROM24C02::pageWrite(
+    uint32_t start_addr,
+    const uint8_t* buffer,
+    uint32_t length,
+    bool repeat) {
+    static_assert((PageSize & (PageSize - 1)) == 0, "page size must be a power of two");
+    static_assert(PageSize <= EEPROM_MAX_PAGE_SIZE, "page size above EEPROM_MAX_PAGE_SIZE");
+    const uint32_t page_size = PageSize ? PageSize : _geometry.page_size;
+
+    // Page writes must not cross page boundaries
+    EEPROMBusSession session(*this);
+    uint32_t bytes_written = 0;
 
     while(bytes_written < length) {
-        uint8_t current_addr = start_addr + bytes_written;
-        uint8_t page_offset = current_addr % EEPROM_24C02_PAGE_SIZE;
-        uint8_t bytes_in_page = EEPROM_24C02_PAGE_SIZE - page_offset;
-        uint8_t bytes_to_write =
+        uint32_t current_addr = start_addr + bytes_written;
+        uint32_t page_offset = PageSize ? (current_addr & (PageSize - 1)) :
+                                          (current_addr % page_size);
+        uint32_t bytes_in_page = page_size - page_offset;
+        uint32_t bytes_to_write =
             (length - bytes_written < bytes_in_page) ? (length - bytes_written) : bytes_in_page;
 
         // Prepare write buffer for this page
-        uint8_t write_buffer[EEPROM_24C02_PAGE_SIZE + 1]; // +1 for address
-        write_buffer[0] = start_addr + bytes_written;
-
-        for(uint8_t i = 0; i < bytes_to_write; i++) {
-            write_buffer[i + 1] = buffer[bytes_written + i];
-        }
+        uint8_t write_buffer[(PageSize ? PageSize : EEPROM_MAX_PAGE_SIZE) + AddressBytes];
+        encodeWordAddress<AddressBytes>(current_addr, write_buffer);
+        memcpy(&write_buffer[AddressBytes], repeat ? buffer : &buffer[bytes_written], bytes_to_write);
 
-        furi_hal_i2c_acquire(&furi_hal_i2c_handle_external);
-
-        bool success = furi_hal_i2c_tx_ext(
-            &furi_hal_i2c_handle_external,
-            _i2c_addr_8bit,
-            false,
+        bool success = _transport->tx(
+            deviceAddress(current_addr),
             write_buffer,
-            bytes_to_write + 1,
-            FuriHalI2cBeginStart,
-            FuriHalI2cEndStop,
+            AddressBytes + bytes_to_write,
+            EEPROMBusBeginStart,
+            EEPROMBusEndStop,
             EEPROM_I2C_TIMEOUT);
 
-        furi_hal_i2c_release(&furi_hal_i2c_handle_external);
-
         if(!success) {
             return false;
         }
 
         // Wait for write cycle to complete
-        furi_delay_ms(10);
+        if(!waitWriteComplete()) {
+            return false;
+        }
 
         bytes_written += bytes_to_write;
     }
@@ -167,40 +374,287 @@ bool EEPROM24C02::writeBytes(uint8_t start_addr, const uint8_t* buffer, uint8_t
     return true;
 }
 
+bool EEPROM24C02::beginPageWrite(uint32_t memory_addr, const uint8_t* buffer, uint32_t length) {
+    if(length == 0 || buffer == nullptr) return false;
+    if(memory_addr + length > _geometry.size) return false;
+    if(memory_addr % _geometry.page_size + length > _geometry.page_size) return false;
+
+    uint8_t write_buffer[EEPROM_MAX_PAGE_SIZE + EEPROM_MAX_ADDRESS_BYTES];
+    uint8_t addr_length = encodeAddress(memory_addr, write_buffer);
+    memcpy(&write_buffer[addr_length], buffer, length);
+
+    EEPROMBusSession session(*this);
+    return _transport->tx(
+        deviceAddress(memory_addr),
+        write_buffer,
+        addr_length + length,
+        EEPROMBusBeginStart,
+        EEPROMBusEndStop,
+        EEPROM_I2C_TIMEOUT);
+}
+
+uint32_t EEPROM24C02::transferBatch(const EEPROMTransfer* transfers, uint32_t count) {
+    EEPROMBusSession session(*this);
+
+    for(uint32_t i = 0; i < count; i++) {
+        const EEPROMTransfer& transfer = transfers[i];
+        bool success = transfer.write ?
+                           writeBytes(transfer.address, transfer.write_data, transfer.length) :
+                           readBytes(transfer.address, transfer.read_data, transfer.length);
+        if(!success) {
+            return i;
+        }
+    }
+
+    return count;
+}
+
 bool EEPROM24C02::eraseAll() {
-    // Fill entire memory with 0xFF
-    uint8_t erase_buffer[EEPROM_24C02_PAGE_SIZE];
-    for(uint8_t i = 0; i < EEPROM_24C02_PAGE_SIZE; i++) {
-        erase_buffer[i] = 0xFF;
+    return eraseRange(0, _geometry.size);
+}
+
+bool EEPROM24C02::eraseRange(uint32_t start_addr, uint32_t length) {
+    if(length == 0 || start_addr >= _geometry.size) return false;
+
+    // Check if range goes beyond memory
+    if(start_addr + length > _geometry.size) {
+        length = _geometry.size - start_addr;
+    }
+
+    // Fill range with 0xFF, page by page from one blank page
+    uint8_t erase_buffer[EEPROM_MAX_PAGE_SIZE];
+    memset(erase_buffer, 0xFF, sizeof(erase_buffer));
+
+    return (this->*_page_write)(start_addr, erase_buffer, length, true);
+}
+
+bool EEPROM24C02::probeRead(
+    uint8_t device_addr,
+    uint32_t word_addr,
+    uint8_t address_bytes,
+    uint8_t* buffer,
+    uint32_t length) {
+    uint8_t addr_buffer[EEPROM_MAX_ADDRESS_BYTES];
+    uint8_t addr_length = 0;
+    if(address_bytes == 2) addr_buffer[addr_length++] = (word_addr >> 8) & 0xFF;
+    addr_buffer[addr_length++] = word_addr & 0xFF;
+
+    return _transport->tx(
+               device_addr,
+               addr_buffer,
+               addr_length,
+               EEPROMBusBeginStart,
+               EEPROMBusEndAwaitRestart,
+               EEPROM_I2C_TIMEOUT) &&
+           _transport->rx(
+               device_addr,
+               buffer,
+               length,
+               EEPROMBusBeginRestart,
+               EEPROMBusEndStop,
+               transferTimeout(length));
+}
+
+bool EEPROM24C02::probeWrite(
+    uint8_t device_addr,
+    uint32_t word_addr,
+    uint8_t address_bytes,
+    const uint8_t* data,
+    uint32_t length) {
+    uint8_t write_buffer[EEPROM_MAX_PAGE_SIZE + EEPROM_MAX_ADDRESS_BYTES];
+    uint8_t addr_length = 0;
+    if(address_bytes == 2) write_buffer[addr_length++] = (word_addr >> 8) & 0xFF;
+    write_buffer[addr_length++] = word_addr & 0xFF;
+    memcpy(&write_buffer[addr_length], data, length);
+
+    return _transport->tx(
+               device_addr,
+               write_buffer,
+               addr_length + length,
+               EEPROMBusBeginStart,
+               EEPROMBusEndStop,
+               EEPROM_I2C_TIMEOUT) &&
+           waitReady(device_addr);
+}
+
+bool EEPROM24C02::probeAddressBytes(uint8_t& address_bytes) {
+    // A 1-byte write to a 2-byte part only loads its address pointer and
+    // stores nothing, so a canary that does not stick means 2-byte addressing.
+    // Two different canaries rule out a coincidental match.
+    static const uint8_t patterns[] = {0x55, 0xAA};
+    uint8_t saved;
+    if(!probeRead(_i2c_addr_8bit, 0, 1, &saved, 1)) return false;
+
+    for(uint8_t i = 0; i < sizeof(patterns); i++) {
+        uint8_t canary = saved ^ patterns[i];
+        uint8_t value;
+        if(!probeWrite(_i2c_addr_8bit, 0, 1, &canary, 1) ||
+           !probeRead(_i2c_addr_8bit, 0, 1, &value, 1)) {
+            return false;
+        }
+        if(value != canary) {
+            address_bytes = 2;
+            return true;
+        }
+    }
+
+    address_bytes = 1;
+    return probeWrite(_i2c_addr_8bit, 0, 1, &saved, 1);
+}
+
+bool EEPROM24C02::probeAliasSize(
+    uint8_t address_bytes,
+    uint32_t first,
+    uint32_t limit,
+    uint32_t& size) {
+    // Parts ignore word address bits above their capacity, so the first
+    // power of two that reads back address 0 is the size. Only offsets that
+    // already hold the same byte as address 0 need the canary check.
+    uint8_t origin;
+    uint8_t values[8];
+    bool candidates = false;
+    if(!probeRead(_i2c_addr_8bit, 0, address_bytes, &origin, 1)) return false;
+
+    uint8_t count = 0;
+    for(uint32_t offset = first; offset < limit; offset <<= 1, count++) {
+        if(!probeRead(_i2c_addr_8bit, offset, address_bytes, &values[count], 1)) return false;
+        if(values[count] == origin) candidates = true;
     }
 
-    // Erase page by page
-    for(uint8_t page = 0; page < EEPROM_24C02_SIZE / EEPROM_24C02_PAGE_SIZE; page++) {
-        uint8_t start_addr = page * EEPROM_24C02_PAGE_SIZE;
-        if(!writeBytes(start_addr, erase_buffer, EEPROM_24C02_PAGE_SIZE)) {
+    size = limit;
+    if(!candidates) return true;
+
+    uint8_t canary = ~origin;
+    if(!probeWrite(_i2c_addr_8bit, 0, address_bytes, &canary, 1)) return false;
+
+    count = 0;
+    for(uint32_t offset = first; offset < limit; offset <<= 1, count++) {
+        uint8_t value;
+        if(values[count] != origin) continue;
+        if(!probeRead(_i2c_addr_8bit, offset, address_bytes, &value, 1)) return false;
+        if(value == canary) {
+            size = offset;
+            break;
+        }
+    }
+
+    return probeWrite(_i2c_addr_8bit, 0, address_bytes, &origin, 1);
+}
+
+bool EEPROM24C02::probeBlockBits(uint8_t& block_bits) {
+    // 24C04/08/16 answer on 2/4/8 device addresses. Another chip may sit on the
+    // next address too, so a block only counts if a sequential read running off
+    // the end of the previous block rolls over into it.
+    block_bits = 0;
+    uint8_t first;
+    if(!probeRead(_i2c_addr_8bit, 0, 1, &first, 1)) return false;
+
+    while(block_bits < 3) {
+        uint8_t block = 1 << block_bits;
+        if(_i2c_addr_8bit & (block << 1)) break;
+
+        uint8_t device_addr = _i2c_addr_8bit | (block << 1);
+        uint8_t previous_addr = _i2c_addr_8bit | ((block - 1) << 1);
+        if(!_transport->isDeviceReady(device_addr, 1)) break;
+
+        uint8_t next;
+        uint8_t rollover[2];
+        if(!probeRead(device_addr, 0, 1, &next, 1) ||
+           !probeRead(previous_addr, 0xFF, 1, rollover, 2)) {
             return false;
         }
+
+        bool same_chip;
+        if(next != first) {
+            same_chip = rollover[1] == next;
+        } else {
+            // Same byte on both sides, mark the new block to tell them apart
+            uint8_t canary = ~next;
+            if(!probeWrite(device_addr, 0, 1, &canary, 1) ||
+               !probeRead(previous_addr, 0xFF, 1, rollover, 2) ||
+               !probeWrite(device_addr, 0, 1, &next, 1)) {
+                return false;
+            }
+            same_chip = rollover[1] == canary;
+        }
+
+        if(!same_chip) break;
+        block_bits++;
     }
 
     return true;
 }
 
-bool EEPROM24C02::eraseRange(uint8_t start_addr, uint8_t length) {
-    if(length == 0) return false;
+bool EEPROM24C02::probePageSize(uint8_t address_bytes, uint16_t& page_size) {
+    // One write of the largest page size wraps around inside a smaller page,
+    // so the byte that lands on address 0 tells how large the page is
+    uint8_t* saved = static_cast<uint8_t*>(malloc(EEPROM_MAX_PAGE_SIZE * 2));
+    if(saved == nullptr) return false;
+    uint8_t* pattern = saved + EEPROM_MAX_PAGE_SIZE;
+    for(uint32_t i = 0; i < EEPROM_MAX_PAGE_SIZE; i++) {
+        pattern[i] = i ^ 0xA5;
+    }
 
-    // Check if range goes beyond memory
-    uint16_t end_addr = (uint16_t)start_addr + length;
-    if(end_addr > EEPROM_24C02_SIZE) {
-        length = EEPROM_24C02_SIZE - start_addr;
+    bool success =
+        probeRead(_i2c_addr_8bit, 0, address_bytes, saved, EEPROM_MAX_PAGE_SIZE) &&
+        probeWrite(_i2c_addr_8bit, 0, address_bytes, pattern, EEPROM_MAX_PAGE_SIZE);
+
+    uint8_t head[2];
+    page_size = 0;
+    if(success) {
+        success = probeRead(_i2c_addr_8bit, 0, address_bytes, head, 2);
+    }
+    if(success) {
+        for(uint16_t size = 4; size <= EEPROM_MAX_PAGE_SIZE; size <<= 1) {
+            uint32_t wrapped = EEPROM_MAX_PAGE_SIZE - size;
+            if(head[0] == pattern[wrapped] && head[1] == pattern[wrapped + 1]) {
+                page_size = size;
+                break;
+            }
+        }
     }
 
-    // Fill range with 0xFF
-    uint8_t erase_buffer[EEPROM_24C02_PAGE_SIZE];
-    for(uint8_t i = 0; i < EEPROM_24C02_PAGE_SIZE; i++) {
-        erase_buffer[i] = 0xFF;
+    // Only the first page was touched; unknown page size restores in the
+    // smallest page there is
+    uint16_t restore_size = page_size ? page_size : 4;
+    uint32_t restore_end = page_size ? page_size : EEPROM_MAX_PAGE_SIZE;
+    for(uint32_t addr = 0; success && addr < restore_end; addr += restore_size) {
+        success = probeWrite(_i2c_addr_8bit, addr, address_bytes, &saved[addr], restore_size);
     }
 
-    return writeBytes(start_addr, erase_buffer, length);
+    free(saved);
+    return success && page_size != 0;
+}
+
+bool EEPROM24C02::detectGeometry(EEPROMGeometry& geometry) {
+    EEPROMBusSession session(*this);
+    uint32_t write_cycle_timeout = _write_cycle_timeout;
+    _write_cycle_timeout = EEPROM_WRITE_CYCLE_TIMEOUT;
+
+    EEPROMGeometry detected;
+    detected.block_bits = 0;
+    detected.write_cycle_ms = EEPROM_WRITE_CYCLE_TIMEOUT / 2;
+
+    bool success = probeAddressBytes(detected.address_bytes);
+    if(success && detected.address_bytes == 2) {
+        // 24C32 (4 KB) through 24C512 (64 KB)
+        success = probeAliasSize(2, 4096, 65536, detected.size);
+    } else if(success) {
+        success = probeBlockBits(detected.block_bits);
+        if(success && detected.block_bits > 0) {
+            detected.size = 256 << detected.block_bits;
+        } else if(success) {
+            // 24C01 (128 bytes) or 24C02 (256 bytes)
+            success = probeAliasSize(1, 128, 256, detected.size);
+        }
+    }
+    if(success) {
+        success = probePageSize(detected.address_bytes, detected.page_size);
+    }
+
+    _write_cycle_timeout = write_cycle_timeout;
+    if(success) geometry = detected;
+    return success;
 }
 
 void EEPROM24C02::setAddress(uint8_t i2c_address_7bit) {
@@ -210,3 +664,39 @@ void EEPROM24C02::setAddress(uint8_t i2c_address_7bit) {
 uint8_t EEPROM24C02::getAddress() {
     return _i2c_addr_8bit >> 1;
 }
+
+EEPROMTransferQueue::EEPROMTransferQueue(EEPROM24C02& eeprom)
+    : _eeprom(eeprom)
+    , _count(0)
+    , _failed(false) {
+}
+
+bool EEPROMTransferQueue::push(const EEPROMTransfer& transfer) {
+    if(_failed) return false;
+
+    _transfers[_count++] = transfer;
+    if(_count == EEPROM_TRANSFER_QUEUE_SIZE) {
+        return flush();
+    }
+
+    return true;
+}
+
+bool EEPROMTransferQueue::read(uint32_t address, uint8_t* buffer, uint32_t length) {
+    EEPROMTransfer transfer = {false, address, nullptr, buffer, length};
+    return push(transfer);
+}
+
+bool EEPROMTransferQueue::write(uint32_t address, const uint8_t* buffer, uint32_t length) {
+    EEPROMTransfer transfer = {true, address, buffer, nullptr, length};
+    return push(transfer);
+}
+
+bool EEPROMTransferQueue::flush() {
+    if(!_failed && _count > 0) {
+        _failed = _eeprom.transferBatch(_transfers, _count) != _count;
+    }
+    _count = 0;
+
+    return !_failed;
+}
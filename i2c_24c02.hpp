@@ -2,53 +2,228 @@
 
 #include <stdint.h>
 #include <stdbool.h>
+#include "i2c_24c02_transport.hpp"
+#include "i2c_24c02_chips.hpp"
 
 // 24C02 EEPROM I2C addresses (7-bit)
 // Standard addresses: 0x50-0x57 (A0-A2 pins)
 #define EEPROM_24C02_BASE_ADDR 0x50
 #define EEPROM_24C02_MAX_ADDR  0x57
 
-// Memory size for 24C02
-#define EEPROM_24C02_SIZE 256  // 2KB = 2048 bits = 256 bytes
-#define EEPROM_24C02_PAGE_SIZE 8  // Page write size
-
 // I2C operation timeout
 #define EEPROM_I2C_TIMEOUT 100
 
+// Upper bound for internal write cycle (tWR) while ACK polling, in ms
+#define EEPROM_WRITE_CYCLE_TIMEOUT 20
+
+// Word address is 1 byte (24C01-24C16) or 2 bytes (24C32-24C512)
+#define EEPROM_MAX_ADDRESS_BYTES 2
+
+// Largest native page in the family (24C512)
+#define EEPROM_MAX_PAGE_SIZE 128
+
+// Chunk size for current-address reads in bulk transfers
+#define EEPROM_READ_CHUNK_SIZE 512
+
+// Progress callback for bulk transfers
+typedef void (*EEPROMProgressCallback)(uint32_t done, uint32_t total, void* context);
+
+// Transfers held by EEPROMTransferQueue before it runs them
+#define EEPROM_TRANSFER_QUEUE_SIZE 8
+
+// One entry of a transfer batch
+typedef struct {
+    bool write; // Page-bounded write, otherwise random read
+    uint32_t address;
+    const uint8_t* write_data;
+    uint8_t* read_data;
+    uint32_t length;
+} EEPROMTransfer;
+
+class EEPROM24C02;
+
+// Holds the bus from construction to destruction; nested sessions are free
+class EEPROMBusSession {
+private:
+    EEPROM24C02& _eeprom;
+
+public:
+    EEPROMBusSession(EEPROM24C02& eeprom);
+    ~EEPROMBusSession();
+
+    // Let other bus users in between batches (outermost session only)
+    void yield();
+};
+
 class EEPROM24C02 {
 private:
+    EEPROMTransport* _transport;
     uint8_t _i2c_addr_8bit;
+    uint32_t _write_cycle_timeout;
+    uint16_t _last_poll_count;
+    EEPROMGeometry _geometry;
+    uint16_t _session_depth;
+    
+    // Hot loops specialized for the current geometry, see selectHotLoops()
+    bool (EEPROM24C02::*_page_write)(
+        uint32_t start_addr,
+        const uint8_t* buffer,
+        uint32_t length,
+        bool repeat);
+    bool (EEPROM24C02::*_sequential_read)(
+        uint32_t start_addr,
+        uint8_t* buffer,
+        uint32_t length,
+        EEPROMProgressCallback callback,
+        void* context);
+    
+    friend class EEPROMBusSession;
+    
+    // Take/give the bus, only the outermost session touches the transport
+    void busAcquire();
+    void busRelease();
+    
+    // 8-bit device address with block select bits for memory address
+    uint8_t deviceAddress(uint32_t memory_addr);
+    
+    // Encode word address into buffer, returns number of bytes used
+    uint8_t encodeAddress(uint32_t memory_addr, uint8_t* buffer);
+    
+    // Bytes readable in one transaction from address (until block end)
+    uint32_t segmentRemaining(uint32_t memory_addr);
+    
+    // Pick the instantiations below matching _geometry
+    void selectHotLoops();
+    
+    // Page writes with address width and page size fixed at compile time
+    // (PageSize 0 takes it from _geometry). With repeat every page is written
+    // from the start of buffer, which must then hold a whole page.
+    template <uint8_t AddressBytes, uint16_t PageSize>
+    bool pageWrite(uint32_t start_addr, const uint8_t* buffer, uint32_t length, bool repeat);
+    
+    // Bulk read with address width fixed at compile time
+    template <uint8_t AddressBytes>
+    bool sequentialRead(
+        uint32_t start_addr,
+        uint8_t* buffer,
+        uint32_t length,
+        EEPROMProgressCallback callback,
+        void* context);
+    
+    // ACK poll given 8-bit device address until its write cycle is done
+    bool waitReady(uint8_t device_addr);
+    
+    // Raw transfers for detection, independent of the current geometry
+    bool probeRead(
+        uint8_t device_addr,
+        uint32_t word_addr,
+        uint8_t address_bytes,
+        uint8_t* buffer,
+        uint32_t length);
+    bool probeWrite(
+        uint8_t device_addr,
+        uint32_t word_addr,
+        uint8_t address_bytes,
+        const uint8_t* data,
+        uint32_t length);
+    
+    // Detection steps, see detectGeometry()
+    bool probeAddressBytes(uint8_t& address_bytes);
+    bool probeAliasSize(uint8_t address_bytes, uint32_t first, uint32_t limit, uint32_t& size);
+    bool probeBlockBits(uint8_t& block_bits);
+    bool probePageSize(uint8_t address_bytes, uint16_t& page_size);
     
 public:
-    EEPROM24C02(uint8_t i2c_address_7bit);
+    EEPROM24C02(EEPROMTransport* transport, uint8_t i2c_address_7bit);
     
     // Initialize communication with EEPROM
     bool init();
     
+    // Set chip geometry (defaults to 24C02)
+    void setGeometry(const EEPROMGeometry& geometry);
+    
+    // Get chip geometry
+    const EEPROMGeometry& getGeometry();
+    
+    // Identify word address width, capacity and page size of the part
+    // Briefly overwrites a few bytes at the start of memory and restores them
+    // write_cycle_ms is left at a safe upper bound; false if detection failed
+    bool detectGeometry(EEPROMGeometry& geometry);
+    
+    // Run transfers in order under one bus session, stops at the first failure
+    // Returns number of transfers completed
+    uint32_t transferBatch(const EEPROMTransfer* transfers, uint32_t count);
+    
     // Read single byte from address
-    bool readByte(uint8_t memory_addr, uint8_t& data);
+    bool readByte(uint32_t memory_addr, uint8_t& data);
     
     // Write single byte to address
-    bool writeByte(uint8_t memory_addr, uint8_t data);
+    bool writeByte(uint32_t memory_addr, uint8_t data);
     
     // Read multiple bytes (sequential read)
-    bool readBytes(uint8_t start_addr, uint8_t* buffer, uint8_t length);
+    bool readBytes(uint32_t start_addr, uint8_t* buffer, uint32_t length);
+    
+    // Bulk read: one addressed read, then current-address reads in large chunks
+    bool readSequential(
+        uint32_t start_addr,
+        uint8_t* buffer,
+        uint32_t length,
+        EEPROMProgressCallback callback = nullptr,
+        void* context = nullptr);
     
     // Write multiple bytes (page write)
-    bool writeBytes(uint8_t start_addr, const uint8_t* buffer, uint8_t length);
+    bool writeBytes(uint32_t start_addr, const uint8_t* buffer, uint32_t length);
+    
+    // Send one page write and return while the chip runs its write cycle
+    // Data must not cross a page boundary; call waitWriteComplete() before
+    // the next transfer to this chip
+    bool beginPageWrite(uint32_t memory_addr, const uint8_t* buffer, uint32_t length);
     
     // Erase entire memory (fill with 0xFF)
     bool eraseAll();
     
     // Erase range of bytes
-    bool eraseRange(uint8_t start_addr, uint8_t length);
+    bool eraseRange(uint32_t start_addr, uint32_t length);
     
     // Check if EEPROM is responding
     bool isAvailable();
     
+    // Poll device for ACK until internal write cycle completes
+    bool waitWriteComplete();
+    
+    // Set upper bound for write cycle polling (ms)
+    void setWriteCycleTimeout(uint32_t timeout_ms);
+    
+    // Number of ACK polls needed by the last write cycle
+    uint16_t getLastPollCount();
+    
     // Set I2C address
     void setAddress(uint8_t i2c_address_7bit);
     
     // Get current I2C address
     uint8_t getAddress();
 };
+
+// Batch builder: queued transfers run under one bus session when the queue
+// fills up or on flush(); buffers must stay valid until then
+// Each entry is an addressed read or a blocking page write, so streaming paths
+// (readSequential, beginPageWrite) hold an EEPROMBusSession directly instead
+class EEPROMTransferQueue {
+private:
+    EEPROM24C02& _eeprom;
+    EEPROMTransfer _transfers[EEPROM_TRANSFER_QUEUE_SIZE];
+    uint32_t _count;
+    bool _failed;
+
+    bool push(const EEPROMTransfer& transfer);
+
+public:
+    EEPROMTransferQueue(EEPROM24C02& eeprom);
+
+    // Queue transfer, false once any transfer of this queue failed
+    bool read(uint32_t address, uint8_t* buffer, uint32_t length);
+    bool write(uint32_t address, const uint8_t* buffer, uint32_t length);
+
+    // Run queued transfers, false if any transfer of this queue failed
+    bool flush();
+};
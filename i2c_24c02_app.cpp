@@ -4,7 +4,6 @@
 #include <gui/canvas.h>
 #include <gui/view.h>
 #include <gui/elements.h>
-#include <furi_hal_i2c.h>
 #include <furi_hal.h>
 #include <furi_hal_gpio.h>
 #include <furi_hal_bus.h>
@@ -13,10 +12,27 @@
 #include <notification/notification.h>
 #include <notification/notification_messages.h>
 #include "i2c_24c02.hpp"
+#include "i2c_24c02_hal.hpp"
+#include "i2c_24c02_chips.hpp"
+#include "i2c_24c02_ops.hpp"
+#include "i2c_24c02_cache.hpp"
+#include "i2c_24c02_search.hpp"
+#include "i2c_24c02_edit.hpp"
 #include "i2c_24c02_startup.h"
 
 #define EEPROM_APP_DIR "/ext/24cxxprog"
 
+// Read screen hex rows
+#define READ_VIEW_ROWS      4
+#define READ_VIEW_ROW_BYTES 8
+#define READ_VIEW_BYTES     (READ_VIEW_ROWS * READ_VIEW_ROW_BYTES)
+
+// Non-blank flag per EEPROM_OP_SUMMARY_BLOCK of the largest chip (24C512)
+#define READ_SUMMARY_BYTES (65536 / EEPROM_OP_SUMMARY_BLOCK / 8)
+
+// Range file offset digits, any offset a FAT file can have
+#define RANGE_OFFSET_DIGITS 8
+
 // UI Layout constants (based on ui_design_prompt.md)
 #define UI_MARGIN_LEFT   2
 #define UI_MARGIN_TOP    10
@@ -39,6 +55,7 @@ typedef enum {
     AppState_Delete,
     AppState_ConfirmDelete,
     AppState_Erase,
+    AppState_Range,
     AppState_Settings,
     AppState_I2CScanner,
     AppState_About,
@@ -51,35 +68,40 @@ typedef enum {
     MainItem_LoadFile,
     MainItem_Delete,
     MainItem_Erase,
+    MainItem_Range,
     MainItem_Settings,
     MainItem_About,
     MainItem_Count
 } MainItem;
 
-// EEPROM chip types with different sizes
-typedef enum {
-    EEPROMType_24C01, // 128 bytes (1Kb)
-    EEPROMType_24C02, // 256 bytes (2Kb)
-    EEPROMType_24C04, // 512 bytes (4Kb)
-    EEPROMType_24C08, // 1024 bytes (8Kb)
-    EEPROMType_24C16, // 2048 bytes (16Kb)
-    EEPROMType_24C32, // 4096 bytes (32Kb)
-    EEPROMType_24C64, // 8192 bytes (64Kb)
-    EEPROMType_24C128, // 16384 bytes (128Kb)
-    EEPROMType_24C256, // 32768 bytes (256Kb)
-    EEPROMType_24C512, // 65536 bytes (512Kb)
-    EEPROMType_Count
-} EEPROMType;
-
 // Settings items
 typedef enum {
     SettingsItem_Address,
     SettingsItem_ViewMode,
     SettingsItem_ChipType,
+    SettingsItem_BusSpeed,
+    SettingsItem_SmartWrite,
+    SettingsItem_Gang,
     SettingsItem_I2CScanner,
     SettingsItem_Count
 } SettingsItem;
 
+// I2C bus clock profiles
+typedef enum {
+    BusSpeed_100k, // Standard-mode, every 24Cxx
+    BusSpeed_400k, // Fast-mode, most 24Cxx
+    BusSpeed_1M, // Fast-mode Plus, newer parts
+    BusSpeed_Count
+} BusSpeed;
+
+static const uint32_t bus_speed_clock[BusSpeed_Count] = {
+    EEPROM_BUS_CLOCK_STANDARD,
+    EEPROM_BUS_CLOCK_FAST,
+    EEPROM_BUS_CLOCK_FAST_PLUS,
+};
+
+static const char* const bus_speed_names[BusSpeed_Count] = {"100 kHz", "400 kHz", "1 MHz"};
+
 // View modes for memory display
 typedef enum {
     ViewMode_Hex,
@@ -87,12 +109,61 @@ typedef enum {
     ViewMode_Both
 } ViewMode;
 
+// Commands accepted by the EEPROM worker thread
+typedef enum {
+    WorkerCmd_Fetch, // Bring the viewer window and the pages ahead of it into the cache
+    WorkerCmd_Summary, // Map blocks holding data, then jump the viewer to the next one
+    WorkerCmd_Search, // Find find_pattern from find_from, wrapping around the chip
+    WorkerCmd_Write, // Write file_path, then verify
+    WorkerCmd_GangWrite, // Write file_path to every chip found on 0x50-0x57, verify each
+    WorkerCmd_Verify, // Compare chip with file_path, by stored CRC32 when there is one
+    WorkerCmd_Erase,
+    WorkerCmd_Commit, // Write the pages holding pending edits
+    WorkerCmd_Probe,
+    WorkerCmd_Scan,
+    WorkerCmd_Dump,
+    WorkerCmd_Stop,
+} EEPROMWorkerCommandType;
+
+typedef struct {
+    EEPROMWorkerCommandType type;
+} EEPROMWorkerCommand;
+
+// Events handled by the main loop
+typedef enum {
+    AppEventType_Input,
+    AppEventType_Worker, // Worker published new state
+    AppEventType_Tick, // Redraw timer while an animation is active
+} AppEventType;
+
+typedef struct {
+    AppEventType type;
+    InputEvent input;
+} AppEvent;
+
+// Block handed between dump reader (worker) and SD writer
+typedef struct {
+    uint8_t index; // Buffer index (0 or 1)
+    uint32_t length; // Valid bytes, 0 ends the stream
+} DumpBlock;
+
+// Double-buffered EEPROM to SD dump pipeline
+typedef struct {
+    File* file;
+    uint8_t* buffers[2];
+    FuriMessageQueue* full_queue; // Filled from I2C, waiting for SD
+    FuriMessageQueue* free_queue; // Written to SD, ready for I2C
+    bool write_error;
+} DumpPipeline;
+
 // Application structure
 typedef struct {
     // Basic system objects
     Gui* gui;
     ViewPort* view_port;
     FuriMutex* mutex;
+    FuriMessageQueue* event_queue;
+    FuriTimer* redraw_timer;
 
     // Application state
     AppState current_state;
@@ -100,25 +171,62 @@ typedef struct {
     uint8_t settings_cursor;
     uint8_t save_file_cursor;
 
+    // EEPROM worker thread (owns all I2C traffic)
+    FuriThread* worker_thread;
+    FuriMessageQueue* worker_queue;
+    volatile bool worker_cancel;
+    volatile bool worker_event_pending;
+
     // EEPROM interface
+    EEPROMHalTransport* transport;
     EEPROM24C02* eeprom;
     uint8_t i2c_address;
     bool eeprom_connected;
     EEPROMType chip_type; // New field for chip type selection
+    EEPROMGeometry geometry; // Geometry in use, from chip table or detection
+    bool chip_detected; // chip_type was identified on the bus
+    bool probing; // WorkerCmd_Probe queued or running, detection writes canary bytes
+    BusSpeed bus_speed; // Lowered automatically when transfers fail
 
-    // Memory data (dynamically allocated based on chip type)
-    uint8_t* memory_data;
+    // Memory viewer, pages are read on demand into a small LRU cache
+    EEPROMPageCache cache;
     uint32_t memory_size; // Current memory size in bytes
     uint32_t current_address;
+    int8_t view_direction; // Last scroll step (+1 down, -1 up), prefetch follows it
+    bool fetching; // WorkerCmd_Fetch queued or running
+    uint32_t view_jump; // Long-press step, doubles on every repeat
+    bool goto_editing; // Go-to-address entry is open
+    uint32_t goto_address;
+    uint8_t goto_cursor; // Hex digit being edited, 0 = most significant
+    bool summarizing; // WorkerCmd_Summary queued or running
+    bool summary_valid; // block_summary matches the chip
+    uint8_t block_summary[READ_SUMMARY_BYTES]; // Bit set per block holding non-0xFF bytes
+    EEPROMPattern find_pattern; // Length 0 until a pattern was entered
+    bool find_editing; // Pattern entry is open
+    uint8_t find_cursor; // Hex digit being edited, two per pattern byte
+    bool searching; // WorkerCmd_Search queued or running
+    bool find_backward; // Search for the previous match
+    uint32_t find_from; // Forward: first address, backward: matches start before it
+    bool find_found; // find_match holds the last match
+    uint32_t find_match;
     uint8_t view_mode;
 
+    // Range used by dump, erase and load, full chip by default
+    uint32_t range_start;
+    uint32_t range_end; // Inclusive
+    uint32_t range_file_offset; // File byte loaded to range_start
+    uint8_t range_cursor; // Hex digit being edited across start, end and offset
+
+    // Range of the queued dump, erase, load or verify
+    uint32_t op_start;
+    uint32_t op_length; // Dump and erase, loads use write/verify totals
+    uint32_t op_file_offset;
+
     // Read/Write operations
-    uint8_t read_start_addr;
-    uint8_t read_length;
-    uint32_t write_start_addr;
-    uint8_t write_data[16];
-    uint8_t write_length;
-    uint8_t write_cursor;
+    EEPROMEditBuffer edits; // Editor changes not written to the chip yet
+    uint32_t edit_address; // Byte under the editor cursor
+    uint8_t edit_nibble; // 0 = high digit
+    bool committing; // WorkerCmd_Commit queued or running
 
     // UI state
     bool operation_success;
@@ -133,34 +241,27 @@ typedef struct {
 
     // Async erase operation
     bool erasing;
-    uint32_t erase_current_addr;
-    uint32_t erase_last_update;
-
-    // Async read operation
-    bool reading;
-    uint32_t read_current_addr;
-    uint32_t read_last_update;
-    uint32_t read_total_bytes;
-    bool read_completed; // Flag to indicate read operation finished
+    uint32_t erase_pages_erased;
+    uint32_t erase_pages_skipped;
 
     // Async write operation (for loading files to EEPROM)
     bool writing;
-    uint32_t write_current_addr_async;
-    uint32_t write_last_update;
     uint32_t write_total_bytes_async;
+    bool smart_write; // Skip pages that already match the file
+    EEPROMWriteStats write_stats; // Pages written/skipped/rewritten, bytes still wrong
+    bool gang_mode; // Load programs every chip found on 0x50-0x57
+    EEPROMGang gang; // Chips and per-chip results of the last gang load
 
-    // Async verify operation (after write)
+    // Async verify operation (after write, or on its own from the load dialog)
     bool verifying;
-    uint32_t verify_current_addr;
-    uint32_t verify_last_update;
+    bool verify_only; // Compare chip with file_path without writing
     uint32_t verify_total_bytes;
-    uint8_t* verify_buffer; // Dynamically allocated
+    EEPROMVerifyStats verify_stats; // Chip CRC32 and differing bytes of the last verify
 
     // File operations
     char file_path[256];
     bool file_loaded;
-    uint8_t* file_data; // Dynamically allocated
-    uint32_t file_size;
+    uint32_t file_size; // Bytes of file_path streamed to EEPROM
 
     // Load confirmation dialog
     bool confirm_load_yes; // For Yes/No selection in confirmation dialog
@@ -170,6 +271,7 @@ typedef struct {
 
     // Save to file operations
     bool save_mode;
+    bool dumping;
     char save_path[256];
 
     // File browser
@@ -193,53 +295,75 @@ typedef struct {
     bool dark_mode;
 } EEPROMApp;
 
-// Helper function to get EEPROM size in bytes
-static uint32_t get_eeprom_size(EEPROMType type) {
-    switch(type) {
-    case EEPROMType_24C01:
-        return 128;
-    case EEPROMType_24C02:
-        return 256;
-    case EEPROMType_24C04:
-        return 512;
-    case EEPROMType_24C08:
-        return 1024;
-    case EEPROMType_24C16:
-        return 2048;
-    case EEPROMType_24C32:
-        return 4096;
-    case EEPROMType_24C64:
-        return 8192;
-    case EEPROMType_24C128:
-        return 16384;
-    case EEPROMType_24C256:
-        return 32768;
-    case EEPROMType_24C512:
-        return 65536;
-    default:
-        return 256;
-    }
+// Hex digits for addresses of the selected chip
+static int address_digits(const EEPROMApp* app) {
+    return get_eeprom_traits(app->chip_type).address_digits;
+}
+
+// Apply app->geometry to the driver when the chip type changes
+static void apply_geometry(EEPROMApp* app) {
+    const EEPROMGeometry& geometry = app->geometry;
+
+    // Keep driver geometry in sync with selected chip
+    app->eeprom->setGeometry(geometry);
+    app->eeprom->setWriteCycleTimeout(geometry.write_cycle_ms * 2);
+
+    // Nothing cached belongs to the new chip
+    app->memory_size = geometry.size;
+    eeprom_cache_reset(&app->cache, geometry.size);
+    app->summary_valid = false;
+    eeprom_edit_reset(&app->edits, geometry.size, geometry.page_size);
+    app->range_start = 0;
+    app->range_end = geometry.size - 1;
+    app->range_cursor = 0;
 }
 
-// Reallocate buffers when chip type changes
-static void reallocate_buffers(EEPROMApp* app) {
-    uint32_t new_size = get_eeprom_size(app->chip_type);
+static uint32_t range_length(const EEPROMApp* app) {
+    return app->range_end - app->range_start + 1;
+}
 
-    // Free old buffers if they exist
-    if(app->memory_data) free(app->memory_data);
-    if(app->file_data) free(app->file_data);
-    if(app->verify_buffer) free(app->verify_buffer);
+static bool range_is_full(const EEPROMApp* app) {
+    return app->range_start == 0 && app->range_end == app->memory_size - 1;
+}
 
-    // Allocate new buffers
-    app->memory_size = new_size;
-    app->memory_data = (uint8_t*)malloc(new_size);
-    app->file_data = (uint8_t*)malloc(new_size);
-    app->verify_buffer = (uint8_t*)malloc(new_size);
+// Hex digits of a Range field: start and end are chip addresses, the last one a file offset
+static uint8_t range_field_digits(const EEPROMApp* app, uint8_t field) {
+    return (field == 2) ? RANGE_OFFSET_DIGITS : address_digits(app);
+}
 
-    // Initialize memory_data to 0xFF
-    if(app->memory_data) {
-        memset(app->memory_data, 0xFF, new_size);
+// Field under the Range cursor, digit within it goes to digit
+static uint8_t range_cursor_field(const EEPROMApp* app, uint8_t* digit) {
+    uint8_t field = 0;
+    uint8_t position = app->range_cursor;
+    while(position >= range_field_digits(app, field)) {
+        position -= range_field_digits(app, field);
+        field++;
     }
+    *digit = position;
+    return field;
+}
+
+// Bytes a load copies: the range, cut short by the end of the file
+static uint32_t range_load_length(const EEPROMApp* app) {
+    if(app->range_file_offset >= app->file_size) return 0;
+    uint32_t available = app->file_size - app->range_file_offset;
+    return (available < range_length(app)) ? available : range_length(app);
+}
+
+static_assert(
+    eeprom_chip_traits[EEPROMType_Count - 1].geometry.size / 64 <= EEPROM_EDIT_MAX_PAGES,
+    "edit dirty bitmap too small for the largest chip");
+
+static_assert(
+    READ_SUMMARY_BYTES * 8 * EEPROM_OP_SUMMARY_BLOCK >=
+        eeprom_chip_traits[EEPROMType_Count - 1].geometry.size,
+    "block summary too small for the largest chip");
+
+// Chip range was written: cached pages go stale, the block summary is redone (mutex held)
+static void viewer_invalidate(EEPROMApp* app, uint32_t start, uint32_t length) {
+    eeprom_cache_invalidate(&app->cache, start, length);
+    app->summary_valid = false;
+    app->find_found = false;
 }
 
 // Function prototypes
@@ -252,12 +376,18 @@ static void draw_erase_screen(Canvas* canvas, EEPROMApp* app);
 static void draw_settings_screen(Canvas* canvas, EEPROMApp* app);
 static void draw_i2c_scanner_screen(Canvas* canvas, EEPROMApp* app);
 static void draw_about_screen(Canvas* canvas, EEPROMApp* app);
+static void draw_range_screen(Canvas* canvas, EEPROMApp* app);
 static void eeprom_draw_callback(Canvas* canvas, void* context);
 static void eeprom_input_callback(InputEvent* input_event, void* context);
+static void eeprom_process_input(EEPROMApp* app, InputEvent* input_event);
 static EEPROMApp* eeprom_app_alloc();
 static void eeprom_app_free(EEPROMApp* app);
 static void show_message(EEPROMApp* app, const char* message, bool success);
-static bool read_memory_range(EEPROMApp* app);
+static void viewer_fetch(EEPROMApp* app);
+static void viewer_scroll(EEPROMApp* app, bool down, uint32_t step);
+static void viewer_goto(EEPROMApp* app, uint32_t address);
+static void viewer_jump_data(EEPROMApp* app);
+static void viewer_find(EEPROMApp* app, bool backward);
 static bool save_memory_to_file(EEPROMApp* app);
 static void scan_directory(EEPROMApp* app, const char* path);
 static void free_file_list(EEPROMApp* app);
@@ -265,13 +395,17 @@ static bool is_valid_extension(const char* filename);
 static void add_directory_entry(EEPROMApp* app, const char* path, const char* name, bool is_dir);
 static bool load_file_from_sd(EEPROMApp* app);
 static void generate_filename(EEPROMApp* app, char* buffer, size_t buffer_size);
-static bool erase_memory_range(EEPROMApp* app, uint8_t start_addr, uint8_t length);
-static bool write_memory_data(EEPROMApp* app);
+static bool erase_memory_range(EEPROMApp* app, uint32_t start_addr, uint32_t length);
+static bool commit_edits(EEPROMApp* app);
+static void editor_move(EEPROMApp* app, int32_t nibbles);
 static void ensure_app_directory(EEPROMApp* app);
-static void process_erase_step(EEPROMApp* app);
-static void process_read_step(EEPROMApp* app);
-static void process_write_step(EEPROMApp* app);
+static bool write_file_data(EEPROMApp* app);
+static bool verify_file_data(EEPROMApp* app);
+static void checksum_path(const char* path, char* buffer, size_t buffer_size);
 static void scan_i2c_bus(EEPROMApp* app);
+static bool worker_busy(EEPROMApp* app);
+static void worker_send(EEPROMApp* app, EEPROMWorkerCommandType type);
+static int32_t eeprom_worker_thread(void* context);
 
 // New function for confirmation dialog
 static void draw_confirm_load_screen(Canvas* canvas, EEPROMApp* app);
@@ -282,7 +416,7 @@ static void draw_main_screen(Canvas* canvas, EEPROMApp* app) {
     canvas_clear(canvas);
 
     const char* menu_items[] = {
-        "Read", "Write", "Load File", "Delete", "Erase", "Settings", "About"};
+        "Read", "Write", "Load File", "Delete", "Erase", "Range", "Settings", "About"};
 
     size_t position = app->main_cursor;
 
@@ -331,126 +465,205 @@ static void draw_main_screen(Canvas* canvas, EEPROMApp* app) {
     elements_button_center(canvas, "OK");
 }
 
+// Byte shown at address: pending edit in the editor, else cached chip data
+static bool viewer_byte(EEPROMApp* app, uint32_t address, bool editing, uint8_t* value) {
+    if(editing && eeprom_edit_get(&app->edits, address, value)) return true;
+
+    // Stale pages stay visible until their refetch lands
+    const uint8_t* page = eeprom_cache_lookup(&app->cache, address, nullptr);
+    if(!page) return false;
+    *value = page[address % EEPROM_CACHE_PAGE_SIZE];
+    return true;
+}
+
+// Dense HEX dump of the viewer window, bytes not cached yet show as --
+// The editor underlines pending edits and inverts the digit under its cursor
+static void draw_hex_rows(Canvas* canvas, EEPROMApp* app, bool editing) {
+    char text[16];
+    int digits = address_digits(app);
+    for(uint8_t i = 0; i < READ_VIEW_ROWS; i++) {
+        uint32_t addr = app->current_address + i * READ_VIEW_ROW_BYTES;
+        if(addr >= app->memory_size) break;
+        uint8_t y = 21 + i * 9;
+
+        // Address as wide as the chip needs
+        snprintf(text, sizeof(text), "%0*lX", digits, addr);
+        canvas_draw_str(canvas, 2, y, text);
+        uint8_t x = 6 + canvas_string_width(canvas, text);
+
+        for(uint8_t j = 0; j < READ_VIEW_ROW_BYTES; j++) {
+            uint32_t address = addr + j;
+            uint8_t value;
+            if(viewer_byte(app, address, editing, &value)) {
+                snprintf(text, sizeof(text), "%02X", value);
+            } else {
+                snprintf(text, sizeof(text), "--");
+            }
+
+            // Small gap between the two halves of a row
+            uint8_t byte_x = x + j * 12 + (j >= 4 ? 2 : 0);
+            if(editing) {
+                uint8_t pending;
+                if(eeprom_edit_get(&app->edits, address, &pending)) {
+                    canvas_draw_line(canvas, byte_x, y + 1, byte_x + 10, y + 1);
+                }
+                for(uint8_t n = 0; n < 2; n++) {
+                    char digit[2] = {text[n], '\0'};
+                    bool cursor = address == app->edit_address && n == app->edit_nibble;
+                    if(cursor) {
+                        canvas_draw_box(canvas, byte_x + n * 6 - 1, y - 7, 7, 8);
+                        canvas_set_color(canvas, ColorWhite);
+                    }
+                    canvas_draw_str(canvas, byte_x + n * 6, y, digit);
+                    canvas_set_color(canvas, ColorBlack);
+                }
+            } else if(
+                app->find_found && address >= app->find_match &&
+                address < app->find_match + app->find_pattern.length) {
+                // Last search match inverted
+                canvas_draw_box(canvas, byte_x - 1, y - 7, 12, 8);
+                canvas_set_color(canvas, ColorWhite);
+                canvas_draw_str(canvas, byte_x, y, text);
+                canvas_set_color(canvas, ColorBlack);
+            } else {
+                canvas_draw_str(canvas, byte_x, y, text);
+            }
+        }
+    }
+}
+
 // Read screen drawing
 static void draw_read_screen(Canvas* canvas, EEPROMApp* app) {
     canvas_clear(canvas);
 
-    canvas_set_font(canvas, FontPrimary);
-    canvas_draw_str(canvas, 2, 10, "Read Memory");
-
-    // Process async read step if needed
-    if(app->reading) {
-        process_read_step(app);
+    // Messages take the title line so all rows stay visible
+    if(app->show_message && furi_get_tick() < app->message_timer) {
+        canvas_set_font(canvas, FontSecondary);
+        canvas_draw_str(canvas, 2, 10, app->message_text);
+    } else {
+        canvas_set_font(canvas, FontPrimary);
+        canvas_draw_str(canvas, 2, 10, "Read Memory");
     }
 
     canvas_set_font(canvas, FontSecondary);
 
-    // Show progress bar if reading
-    if(app->show_progress && app->reading) {
-        canvas_draw_str(canvas, 2, 24, "Reading EEPROM...");
+    // Show progress bar while dumping or mapping data blocks
+    if(app->show_progress && (app->dumping || app->summarizing || app->searching)) {
+        uint32_t total = app->dumping ? app->op_length : app->memory_size;
+        const char* activity = "Searching...";
+        if(app->dumping) {
+            activity = "Saving to SD...";
+        } else if(app->summarizing) {
+            activity = "Finding data...";
+        }
+        canvas_draw_str(canvas, 2, 24, activity);
 
         // Progress bar
         canvas_draw_frame(canvas, 12, 32, 100, 7);
-        uint8_t fill_width = (app->progress_value * 98) / app->read_total_bytes;
+        uint8_t fill_width = (app->progress_value * 98) / total;
         if(fill_width > 0) {
             canvas_draw_box(canvas, 13, 33, fill_width, 5);
         }
 
         // Progress percentage
         char progress_text[16];
-        snprintf(
-            progress_text,
-            sizeof(progress_text),
-            "%lu%%",
-            (app->progress_value * 100) / app->read_total_bytes);
+        snprintf(progress_text, sizeof(progress_text), "%lu%%", (app->progress_value * 100) / total);
         canvas_draw_str(canvas, 54, 48, progress_text);
-    } else {
-        // Display memory data - HEX dump (max 3 lines)
-        char display_line[32];
+        return;
+    }
 
-        for(uint8_t i = 0; i < 3 && (app->current_address + i * 4) < app->memory_size; i++) {
-            uint32_t addr = app->current_address + i * 4;
-            // Format address based on memory size
-            if(app->memory_size <= 256) {
-                snprintf(
-                    display_line,
-                    sizeof(display_line),
-                    "0x%02lX: %02X %02X %02X %02X",
-                    addr,
-                    app->memory_data[addr],
-                    app->memory_data[addr + 1],
-                    app->memory_data[addr + 2],
-                    app->memory_data[addr + 3]);
+    char text[16];
+    int digits = address_digits(app);
+    if(app->goto_editing) {
+        canvas_draw_str(canvas, 2, 24, "Go to address:");
+
+        // One box per hex digit, the edited one inverted
+        canvas_draw_str(canvas, 2, 37, "0x");
+        for(int i = 0; i < digits; i++) {
+            uint8_t x = 14 + i * 9;
+            snprintf(text, sizeof(text), "%lX", (app->goto_address >> (4 * (digits - 1 - i))) & 0xF);
+            if(i == app->goto_cursor) {
+                canvas_draw_box(canvas, x - 1, 28, 8, 11);
+                canvas_set_color(canvas, ColorWhite);
+                canvas_draw_str(canvas, x, 37, text);
+                canvas_set_color(canvas, ColorBlack);
             } else {
-                snprintf(
-                    display_line,
-                    sizeof(display_line),
-                    "%04lX:%02X %02X %02X %02X",
-                    addr,
-                    app->memory_data[addr],
-                    app->memory_data[addr + 1],
-                    app->memory_data[addr + 2],
-                    app->memory_data[addr + 3]);
+                canvas_draw_str(canvas, x, 37, text);
             }
-            canvas_draw_str(canvas, 2, 22 + i * 9, display_line);
         }
+        canvas_draw_str(canvas, 2, 48, "U/D: Digit  L/R: Move");
 
-        // Show message if needed
-        if(app->show_message && furi_get_tick() < app->message_timer) {
-            canvas_draw_str(canvas, 2, 48, app->message_text);
+        elements_button_center(canvas, "Go");
+        return;
+    }
+
+    if(app->find_editing) {
+        const EEPROMPattern* pattern = &app->find_pattern;
+        canvas_draw_str(canvas, 2, 24, "Find bytes:");
+
+        // Two digits per byte, ?? for wildcards, the edited digit inverted
+        for(uint8_t i = 0; i < pattern->length * 2; i++) {
+            uint8_t x = 2 + (i / 2) * 15 + (i % 2) * 6;
+            if(pattern->wild[i / 2]) {
+                snprintf(text, sizeof(text), "?");
+            } else {
+                uint8_t digit = (pattern->bytes[i / 2] >> ((i % 2) ? 0 : 4)) & 0xF;
+                snprintf(text, sizeof(text), "%X", digit);
+            }
+            if(i == app->find_cursor) {
+                canvas_draw_box(canvas, x - 1, 28, 7, 11);
+                canvas_set_color(canvas, ColorWhite);
+                canvas_draw_str(canvas, x, 37, text);
+                canvas_set_color(canvas, ColorBlack);
+            } else {
+                canvas_draw_str(canvas, x, 37, text);
+            }
         }
+        canvas_draw_str(canvas, 2, 48, "Right: add  Hold Left: del");
+
+        elements_button_center(canvas, "Find");
+        return;
     }
 
+    draw_hex_rows(canvas, app, false);
+
     // Buttons
-    elements_button_left(canvas, "Back");
-    if(app->read_completed) {
-        elements_button_center(canvas, "Save");
-    } else {
-        elements_button_center(canvas, "Read");
-    }
+    elements_button_left(canvas, "Go to");
+    elements_button_center(canvas, "Save");
+    elements_button_right(canvas, "Data");
 }
 
-// Write screen drawing
+// Write screen drawing: hex editor over the viewer window
 static void draw_write_screen(Canvas* canvas, EEPROMApp* app) {
     canvas_clear(canvas);
 
-    canvas_set_font(canvas, FontPrimary);
-    canvas_draw_str(canvas, 2, 10, "Write Byte");
-
-    canvas_set_font(canvas, FontSecondary);
-
-    // Show write address with selection indicator
-    char addr_line[32];
-    if(app->write_cursor == 0) {
-        if(app->memory_size <= 256) {
-            snprintf(addr_line, sizeof(addr_line), "> Address: 0x%02lX", app->write_start_addr);
-        } else {
-            snprintf(addr_line, sizeof(addr_line), "> Addr: 0x%04lX", app->write_start_addr);
-        }
+    if(app->show_message && furi_get_tick() < app->message_timer) {
+        canvas_set_font(canvas, FontSecondary);
+        canvas_draw_str(canvas, 2, 10, app->message_text);
     } else {
-        if(app->memory_size <= 256) {
-            snprintf(addr_line, sizeof(addr_line), "  Address: 0x%02lX", app->write_start_addr);
-        } else {
-            snprintf(addr_line, sizeof(addr_line), "  Addr: 0x%04lX", app->write_start_addr);
+        canvas_set_font(canvas, FontPrimary);
+        canvas_draw_str(canvas, 2, 10, "Edit Memory");
+
+        // Pages the next commit will write
+        uint32_t pages = eeprom_edit_dirty_pages(&app->edits);
+        if(pages > 0) {
+            char pages_str[16];
+            snprintf(pages_str, sizeof(pages_str), "%lu pg", pages);
+            canvas_set_font(canvas, FontSecondary);
+            canvas_draw_str_aligned(canvas, 126, 2, AlignRight, AlignTop, pages_str);
         }
     }
-    canvas_draw_str(canvas, 2, 24, addr_line);
 
-    // Show data to write with selection indicator
-    char data_line[32];
-    if(app->write_cursor == 1) {
-        snprintf(data_line, sizeof(data_line), "> Data:    0x%02X", app->write_data[0]);
-    } else {
-        snprintf(data_line, sizeof(data_line), "  Data:    0x%02X", app->write_data[0]);
+    canvas_set_font(canvas, FontSecondary);
+    if(app->committing) {
+        canvas_draw_str(canvas, 2, 24, "Writing pages...");
+        return;
     }
-    canvas_draw_str(canvas, 2, 34, data_line);
 
-    // Instructions
-    canvas_draw_str(canvas, 2, 46, "U/D: Select  L/R: Change");
+    draw_hex_rows(canvas, app, true);
 
     // Buttons
-    elements_button_left(canvas, "Back");
-    elements_button_center(canvas, "Write");
+    elements_button_center(canvas, "Commit");
 }
 
 // Load file screen drawing
@@ -569,6 +782,18 @@ static void draw_save_file_screen(Canvas* canvas, EEPROMApp* app) {
 
     canvas_set_font(canvas, FontSecondary);
 
+    if(app->dumping) {
+        canvas_draw_str_aligned(canvas, 64, 18, AlignCenter, AlignTop, "Dumping EEPROM...");
+
+        // Progress bar
+        canvas_draw_frame(canvas, 12, 32, 100, 7);
+        uint8_t fill_width = (app->progress_value * 98) / app->op_length;
+        if(fill_width > 0) {
+            canvas_draw_box(canvas, 13, 33, fill_width, 5);
+        }
+        return;
+    }
+
     // Show auto-save info
     canvas_draw_str_aligned(canvas, 64, 22, AlignCenter, AlignTop, "Auto-save with timestamp:");
 
@@ -592,18 +817,27 @@ static void draw_erase_screen(Canvas* canvas, EEPROMApp* app) {
     canvas_draw_str(canvas, 2, 10, "Erase Memory");
 
     canvas_set_font(canvas, FontSecondary);
-    canvas_draw_str(canvas, 2, 24, "Erase all to 0xFF");
-
-    // Process async erase step if needed
-    if(app->erasing) {
-        process_erase_step(app);
+    if(range_is_full(app)) {
+        canvas_draw_str(canvas, 2, 24, "Erase all to 0xFF");
+    } else {
+        char range_text[32];
+        int digits = address_digits(app);
+        snprintf(
+            range_text,
+            sizeof(range_text),
+            "Erase %0*lX-%0*lX to 0xFF",
+            digits,
+            app->range_start,
+            digits,
+            app->range_end);
+        canvas_draw_str(canvas, 2, 24, range_text);
     }
 
     // Show progress bar if erasing
     if(app->show_progress) {
         // Progress bar
         canvas_draw_frame(canvas, 12, 34, 100, 7);
-        uint8_t fill_width = (app->progress_value * 98) / app->memory_size;
+        uint8_t fill_width = (app->progress_value * 98) / app->op_length;
         if(fill_width > 0) {
             canvas_draw_box(canvas, 13, 35, fill_width, 5);
         }
@@ -614,12 +848,23 @@ static void draw_erase_screen(Canvas* canvas, EEPROMApp* app) {
             progress_text,
             sizeof(progress_text),
             "%lu%%",
-            (app->progress_value * 100) / app->memory_size);
+            (app->progress_value * 100) / app->op_length);
         canvas_draw_str(canvas, 54, 46, progress_text);
     } else {
         // Show message if needed
         if(app->show_message && furi_get_tick() < app->message_timer) {
             canvas_draw_str(canvas, 2, 36, app->message_text);
+
+            if(app->operation_success) {
+                char stats_text[32];
+                snprintf(
+                    stats_text,
+                    sizeof(stats_text),
+                    "Pages: %lu erased, %lu skip",
+                    app->erase_pages_erased,
+                    app->erase_pages_skipped);
+                canvas_draw_str(canvas, 2, 46, stats_text);
+            }
         }
         // Buttons
         elements_button_left(canvas, "Back");
@@ -627,6 +872,48 @@ static void draw_erase_screen(Canvas* canvas, EEPROMApp* app) {
     }
 }
 
+// Range screen drawing: start, end and file offset as hex digits
+static void draw_range_screen(Canvas* canvas, EEPROMApp* app) {
+    canvas_clear(canvas);
+
+    canvas_set_font(canvas, FontPrimary);
+    canvas_draw_str(canvas, 2, 10, "Range");
+
+    char text[16];
+    canvas_set_font(canvas, FontSecondary);
+    snprintf(text, sizeof(text), "%lu bytes", range_length(app));
+    canvas_draw_str_aligned(canvas, 126, 2, AlignRight, AlignTop, text);
+
+    static const char* const labels[3] = {"Start:", "End:", "File offset:"};
+    uint32_t values[3] = {app->range_start, app->range_end, app->range_file_offset};
+    uint8_t cursor_digit;
+    uint8_t cursor_field = range_cursor_field(app, &cursor_digit);
+    for(uint8_t field = 0; field < 3; field++) {
+        uint8_t y = 23 + field * 11;
+        canvas_draw_str(canvas, 2, y, labels[field]);
+        canvas_draw_str(canvas, 62, y, "0x");
+
+        // One box per hex digit, the edited one inverted; the offset packs its 8 digits closer
+        int digits = range_field_digits(app, field);
+        uint8_t step = (field == 2) ? 6 : 9;
+        uint8_t box = (field == 2) ? 7 : 8;
+        for(int i = 0; i < digits; i++) {
+            uint8_t x = 74 + i * step;
+            snprintf(text, sizeof(text), "%lX", (values[field] >> (4 * (digits - 1 - i))) & 0xF);
+            if(field == cursor_field && i == cursor_digit) {
+                canvas_draw_box(canvas, x - 1, y - 9, box, 11);
+                canvas_set_color(canvas, ColorWhite);
+                canvas_draw_str(canvas, x, y, text);
+                canvas_set_color(canvas, ColorBlack);
+            } else {
+                canvas_draw_str(canvas, x, y, text);
+            }
+        }
+    }
+
+    elements_button_center(canvas, "Full chip");
+}
+
 // Settings screen drawing
 static void draw_settings_screen(Canvas* canvas, EEPROMApp* app) {
     canvas_clear(canvas);
@@ -677,23 +964,32 @@ static void draw_settings_screen(Canvas* canvas, EEPROMApp* app) {
             canvas_draw_str_aligned(canvas, 113, y - 1, AlignRight, AlignTop, "Hex");
             break;
         case SettingsItem_ChipType: {
-            const char* chip_types[] = {
-                "24C01", // 128B
-                "24C02", // 256B
-                "24C04", // 512B
-                "24C08", // 1KB
-                "24C16", // 2KB
-                "24C32", // 4KB
-                "24C64", // 8KB
-                "24C128", // 16KB
-                "24C256", // 32KB
-                "24C512" // 64KB
-            };
+            char chip_str[16];
+            snprintf(
+                chip_str,
+                sizeof(chip_str),
+                "%s%s",
+                get_eeprom_traits(app->chip_type).name,
+                app->chip_detected ? " (auto)" : "");
             canvas_draw_str(canvas, 5, y + 5, "Chip:");
-            canvas_draw_str_aligned(
-                canvas, 113, y - 1, AlignRight, AlignTop, chip_types[app->chip_type]);
+            canvas_draw_str_aligned(canvas, 113, y - 1, AlignRight, AlignTop, chip_str);
             break;
         }
+        case SettingsItem_BusSpeed:
+            canvas_draw_str(canvas, 5, y + 5, "Bus speed:");
+            canvas_draw_str_aligned(
+                canvas, 113, y - 1, AlignRight, AlignTop, bus_speed_names[app->bus_speed]);
+            break;
+        case SettingsItem_SmartWrite:
+            canvas_draw_str(canvas, 5, y + 5, "Smart write:");
+            canvas_draw_str_aligned(
+                canvas, 113, y - 1, AlignRight, AlignTop, app->smart_write ? "On" : "Off");
+            break;
+        case SettingsItem_Gang:
+            canvas_draw_str(canvas, 5, y + 5, "Gang load:");
+            canvas_draw_str_aligned(
+                canvas, 113, y - 1, AlignRight, AlignTop, app->gang_mode ? "0x50-57" : "Off");
+            break;
         case SettingsItem_I2CScanner:
             canvas_draw_str(canvas, 5, y + 5, "I2C Scanner");
             canvas_draw_str_aligned(canvas, 113, y - 1, AlignRight, AlignTop, ">");
@@ -718,6 +1014,12 @@ static void draw_i2c_scanner_screen(Canvas* canvas, EEPROMApp* app) {
 
     canvas_set_font(canvas, FontSecondary);
 
+    if(app->scanning_i2c) {
+        canvas_draw_str_aligned(canvas, 64, 30, AlignCenter, AlignTop, "Scanning...");
+        elements_button_left(canvas, "Back");
+        return;
+    }
+
     // Show device count
     char count_str[32];
     snprintf(count_str, sizeof(count_str), "Found: %d device(s)", app->i2c_device_count);
@@ -764,15 +1066,75 @@ static void draw_i2c_scanner_screen(Canvas* canvas, EEPROMApp* app) {
     elements_button_left(canvas, "Back");
 }
 
+// Per-chip outcome of a gang load: address over result, failures inverted
+static void draw_gang_results(Canvas* canvas, EEPROMApp* app) {
+    canvas_draw_str_aligned(canvas, 64, 2, AlignCenter, AlignTop, app->message_text);
+
+    canvas_set_font(canvas, FontSecondary);
+    for(uint8_t i = 0; i < app->gang.count; i++) {
+        const char* result;
+        switch(app->gang.results[i]) {
+        case EEPROMOpOk:
+            result = "OK";
+            break;
+        case EEPROMOpWriteError:
+            result = "WR";
+            break;
+        case EEPROMOpReadError:
+            result = "RD";
+            break;
+        default:
+            result = "DF"; // Readback differs
+            break;
+        }
+
+        char addr_str[4];
+        snprintf(addr_str, sizeof(addr_str), "%02X", app->gang.addresses[i]);
+        uint8_t x = 4 + i * 15;
+        canvas_draw_str(canvas, x + 1, 24, addr_str);
+        if(app->gang.results[i] != EEPROMOpOk) {
+            canvas_draw_box(canvas, x, 27, 14, 10);
+            canvas_set_color(canvas, ColorWhite);
+        }
+        canvas_draw_str(canvas, x + 1, 35, result);
+        canvas_set_color(canvas, ColorBlack);
+    }
+}
+
+// Outcome of comparing the chip with a file
+static void draw_verify_result(Canvas* canvas, EEPROMApp* app) {
+    const EEPROMVerifyStats& stats = app->verify_stats;
+    canvas_draw_str_aligned(
+        canvas,
+        64,
+        2,
+        AlignCenter,
+        AlignTop,
+        app->operation_success ? "Verify OK" : "Verify Failed");
+
+    canvas_set_font(canvas, FontSecondary);
+    char line[32];
+    if(stats.bytes_differ > 0) {
+        snprintf(line, sizeof(line), "%lu bytes differ", stats.bytes_differ);
+        canvas_draw_str_aligned(canvas, 64, 16, AlignCenter, AlignTop, line);
+        snprintf(
+            line, sizeof(line), "First at 0x%0*lX", address_digits(app), stats.first_difference);
+        canvas_draw_str_aligned(canvas, 64, 26, AlignCenter, AlignTop, line);
+    } else {
+        canvas_draw_str_aligned(canvas, 64, 16, AlignCenter, AlignTop, app->message_text);
+    }
+
+    // CRC32 of what was read, matches `crc32` of the file when equal
+    if(app->operation_success || stats.bytes_differ > 0) {
+        snprintf(line, sizeof(line), "Chip CRC32 %08lX", stats.crc);
+        canvas_draw_str_aligned(canvas, 64, 38, AlignCenter, AlignTop, line);
+    }
+}
+
 // Confirmation dialog for loading file to EEPROM
 static void draw_confirm_load_screen(Canvas* canvas, EEPROMApp* app) {
     canvas_clear(canvas);
 
-    // Process async write/verify step if needed
-    if(app->writing || app->verifying) {
-        process_write_step(app);
-    }
-
     canvas_set_font(canvas, FontPrimary);
 
     // If writing, show write progress
@@ -780,7 +1142,13 @@ static void draw_confirm_load_screen(Canvas* canvas, EEPROMApp* app) {
         canvas_draw_str_aligned(canvas, 64, 2, AlignCenter, AlignTop, "Loading to EEPROM");
 
         canvas_set_font(canvas, FontSecondary);
-        canvas_draw_str_aligned(canvas, 64, 15, AlignCenter, AlignTop, "Stage 1/2: Writing...");
+        canvas_draw_str_aligned(
+            canvas,
+            64,
+            15,
+            AlignCenter,
+            AlignTop,
+            app->gang_mode ? "Stage 1/2: Writing..." : "Writing + verifying...");
 
         // Progress bar (same style as Read screen)
         canvas_draw_frame(canvas, 12, 28, 100, 7);
@@ -801,10 +1169,22 @@ static void draw_confirm_load_screen(Canvas* canvas, EEPROMApp* app) {
         snprintf(progress_str, sizeof(progress_str), "%u%%", percent);
         canvas_draw_str_aligned(canvas, 64, 46, AlignCenter, AlignTop, progress_str);
     } else if(app->verifying) {
-        canvas_draw_str_aligned(canvas, 64, 2, AlignCenter, AlignTop, "Loading to EEPROM");
+        canvas_draw_str_aligned(
+            canvas,
+            64,
+            2,
+            AlignCenter,
+            AlignTop,
+            app->verify_only ? "Verifying EEPROM" : "Loading to EEPROM");
 
         canvas_set_font(canvas, FontSecondary);
-        canvas_draw_str_aligned(canvas, 64, 15, AlignCenter, AlignTop, "Stage 2/2: Verifying...");
+        canvas_draw_str_aligned(
+            canvas,
+            64,
+            15,
+            AlignCenter,
+            AlignTop,
+            app->verify_only ? "Comparing with file..." : "Stage 2/2: Verifying...");
 
         // Progress bar (same style as Read screen)
         canvas_draw_frame(canvas, 12, 28, 100, 7);
@@ -824,25 +1204,89 @@ static void draw_confirm_load_screen(Canvas* canvas, EEPROMApp* app) {
         char progress_str[16];
         snprintf(progress_str, sizeof(progress_str), "%u%%", percent);
         canvas_draw_str_aligned(canvas, 64, 46, AlignCenter, AlignTop, progress_str);
+    } else if(app->show_message && app->gang.count > 0) {
+        draw_gang_results(canvas, app);
+        elements_button_center(canvas, "OK");
+    } else if(app->show_message && app->verify_only) {
+        draw_verify_result(canvas, app);
+        elements_button_center(canvas, "OK");
     } else if(app->show_message) {
         // Show completion message after write+verify
         if(app->operation_success) {
             canvas_draw_str_aligned(canvas, 64, 2, AlignCenter, AlignTop, "Load Complete");
             canvas_set_font(canvas, FontSecondary);
-            canvas_draw_str_aligned(canvas, 64, 20, AlignCenter, AlignTop, "Stage 1: Write OK");
-            canvas_draw_str_aligned(canvas, 64, 30, AlignCenter, AlignTop, "Stage 2: Verify OK");
-            canvas_set_font(canvas, FontPrimary);
-            canvas_draw_str_aligned(canvas, 64, 45, AlignCenter, AlignTop, "SUCCESS");
+            canvas_draw_str_aligned(canvas, 64, 20, AlignCenter, AlignTop, "Write + verify OK");
+            if(app->write_stats.pages_retried > 0) {
+                char retry_str[32];
+                snprintf(
+                    retry_str,
+                    sizeof(retry_str),
+                    "Rewrote %lu pages",
+                    app->write_stats.pages_retried);
+                canvas_draw_str_aligned(canvas, 64, 30, AlignCenter, AlignTop, retry_str);
+            } else if(app->write_stats.pages_written > 0) {
+                // Write cycle length as seen by ACK polling
+                char poll_str[32];
+                snprintf(
+                    poll_str,
+                    sizeof(poll_str),
+                    "ACK polls: %u max/page",
+                    app->write_stats.max_page_polls);
+                canvas_draw_str_aligned(canvas, 64, 30, AlignCenter, AlignTop, poll_str);
+            }
+            if(app->write_stats.pages_skipped > 0) {
+                // Smart write summary instead of banner
+                char skip_str[32];
+                snprintf(
+                    skip_str,
+                    sizeof(skip_str),
+                    "Skipped %lu/%lu pages",
+                    app->write_stats.pages_skipped,
+                    app->write_stats.pages_written + app->write_stats.pages_skipped);
+                canvas_draw_str_aligned(canvas, 64, 42, AlignCenter, AlignTop, skip_str);
+            } else {
+                canvas_set_font(canvas, FontPrimary);
+                canvas_draw_str_aligned(canvas, 64, 45, AlignCenter, AlignTop, "SUCCESS");
+            }
         } else {
             canvas_draw_str_aligned(canvas, 64, 2, AlignCenter, AlignTop, "Load Failed");
             canvas_set_font(canvas, FontSecondary);
-            canvas_draw_str_aligned(canvas, 64, 25, AlignCenter, AlignTop, app->message_text);
+            if(app->write_stats.bytes_failed > 0) {
+                canvas_draw_str_aligned(canvas, 64, 14, AlignCenter, AlignTop, app->message_text);
+
+                // Bytes still wrong after all rewrites, four per line
+                uint32_t listed = app->write_stats.bytes_failed;
+                if(listed > EEPROM_OP_FAILED_REPORT) listed = EEPROM_OP_FAILED_REPORT;
+                int digits = address_digits(app);
+                for(uint32_t row = 0; row * 4 < listed; row++) {
+                    char line[40];
+                    size_t pos = 0;
+                    for(uint32_t i = row * 4; i < listed && i < row * 4 + 4; i++) {
+                        pos += snprintf(
+                            line + pos,
+                            sizeof(line) - pos,
+                            "%0*lX ",
+                            digits,
+                            app->write_stats.failed_addresses[i]);
+                    }
+                    canvas_draw_str_aligned(
+                        canvas, 64, 24 + row * 10, AlignCenter, AlignTop, line);
+                }
+            } else {
+                canvas_draw_str_aligned(canvas, 64, 25, AlignCenter, AlignTop, app->message_text);
+            }
         }
 
         elements_button_center(canvas, "OK");
     } else {
         // Show confirmation dialog
-        canvas_draw_str_aligned(canvas, 64, 2, AlignCenter, AlignTop, "Load to EEPROM?");
+        canvas_draw_str_aligned(
+            canvas,
+            64,
+            2,
+            AlignCenter,
+            AlignTop,
+            app->gang_mode ? "Load to all EEPROMs?" : "Load to EEPROM?");
 
         canvas_set_font(canvas, FontSecondary);
 
@@ -857,8 +1301,8 @@ static void draw_confirm_load_screen(Canvas* canvas, EEPROMApp* app) {
         strncpy(display_name, filename, sizeof(display_name) - 1);
         display_name[sizeof(display_name) - 1] = '\0';
 
-        canvas_draw_str_aligned(canvas, 64, 20, AlignCenter, AlignTop, "File:");
-        canvas_draw_str_aligned(canvas, 64, 30, AlignCenter, AlignTop, display_name);
+        canvas_draw_str_aligned(canvas, 64, 16, AlignCenter, AlignTop, display_name);
+        canvas_draw_str_aligned(canvas, 64, 27, AlignCenter, AlignTop, "Up: verify only");
 
         // Show Yes/No buttons
         if(app->confirm_load_yes) {
@@ -946,6 +1390,9 @@ static void eeprom_draw_callback(Canvas* canvas, void* context) {
     furi_assert(context);
     EEPROMApp* app = static_cast<EEPROMApp*>(context);
 
+    // Worker publishes state under mutex - draw a consistent snapshot
+    furi_mutex_acquire(app->mutex, FuriWaitForever);
+
     // Increment scroll counter for animated text scrolling
     app->scroll_counter++;
 
@@ -977,6 +1424,9 @@ static void eeprom_draw_callback(Canvas* canvas, void* context) {
     case AppState_Erase:
         draw_erase_screen(canvas, app);
         break;
+    case AppState_Range:
+        draw_range_screen(canvas, app);
+        break;
     case AppState_Settings:
         draw_settings_screen(canvas, app);
         break;
@@ -987,14 +1437,57 @@ static void eeprom_draw_callback(Canvas* canvas, void* context) {
         draw_about_screen(canvas, app);
         break;
     }
+
+    furi_mutex_release(app->mutex);
 }
 
-// Input callback
+// Input callback - forward to main loop
 static void eeprom_input_callback(InputEvent* input_event, void* context) {
     furi_assert(context);
     EEPROMApp* app = static_cast<EEPROMApp*>(context);
 
-    if(input_event->type == InputTypeShort || input_event->type == InputTypeRepeat) {
+    AppEvent event;
+    event.type = AppEventType_Input;
+    event.input = *input_event;
+    furi_message_queue_put(app->event_queue, &event, FuriWaitForever);
+}
+
+// Redraw timer callback - runs only while an animation is active
+static void eeprom_redraw_timer_callback(void* context) {
+    EEPROMApp* app = static_cast<EEPROMApp*>(context);
+
+    AppEvent event;
+    event.type = AppEventType_Tick;
+    furi_message_queue_put(app->event_queue, &event, 0);
+}
+
+// Start or stop redraw timer depending on visible animations (call with mutex held)
+static void update_redraw_timer(EEPROMApp* app) {
+    bool message_visible = app->show_message && furi_get_tick() < app->message_timer;
+    bool animating = app->browsing_files || message_visible;
+    bool timer_running = furi_timer_is_running(app->redraw_timer);
+
+    if(animating && !timer_running) {
+        furi_timer_start(app->redraw_timer, furi_ms_to_ticks(100));
+    } else if(!animating && timer_running) {
+        furi_timer_stop(app->redraw_timer);
+    }
+}
+
+// Input handling - called from main loop
+static void eeprom_process_input(EEPROMApp* app, InputEvent* input_event) {
+    furi_mutex_acquire(app->mutex, FuriWaitForever);
+
+    // Held OK/Left/Right in the viewer and editor are long-press actions, their repeats
+    // are not presses
+    bool held_action = input_event->type == InputTypeRepeat &&
+                       (app->current_state == AppState_Read ||
+                        app->current_state == AppState_Write) &&
+                       (input_event->key == InputKeyOk || input_event->key == InputKeyLeft ||
+                        input_event->key == InputKeyRight);
+
+    if(input_event->type == InputTypeShort ||
+       (input_event->type == InputTypeRepeat && !held_action)) {
         switch(app->current_state) {
         case AppState_Main:
             if(input_event->key == InputKeyUp) {
@@ -1005,11 +1498,13 @@ static void eeprom_input_callback(InputEvent* input_event, void* context) {
                 switch(app->main_cursor) {
                 case MainItem_Read:
                     app->current_state = AppState_Read;
-                    read_memory_range(app);
+                    app->goto_editing = false;
+                    // A range picked for this chip is where reading starts
+                    viewer_goto(app, range_is_full(app) ? app->current_address : app->range_start);
                     break;
                 case MainItem_Write:
                     app->current_state = AppState_Write;
-                    app->write_cursor = 0;
+                    editor_move(app, 0);
                     break;
                 case MainItem_LoadFile:
                     app->current_state = AppState_LoadFile;
@@ -1038,6 +1533,9 @@ static void eeprom_input_callback(InputEvent* input_event, void* context) {
                 case MainItem_Erase:
                     app->current_state = AppState_Erase;
                     break;
+                case MainItem_Range:
+                    app->current_state = AppState_Range;
+                    break;
                 case MainItem_Settings:
                     app->current_state = AppState_Settings;
                     break;
@@ -1049,93 +1547,124 @@ static void eeprom_input_callback(InputEvent* input_event, void* context) {
             break;
 
         case AppState_Read:
-            if(input_event->key == InputKeyUp) {
-                if(app->current_address >= 4) app->current_address -= 4;
-            } else if(input_event->key == InputKeyDown) {
-                if(app->current_address + 4 < app->memory_size) app->current_address += 4;
-            } else if(input_event->key == InputKeyOk) {
-                if(app->read_completed) {
-                    // Data has been read, save immediately with auto-generated filename
-                    ensure_app_directory(app);
-                    char filename[64];
-                    generate_filename(app, filename, sizeof(filename));
-
-                    // Build full path
-                    snprintf(
-                        app->save_path,
-                        sizeof(app->save_path),
-                        "%s/%s.bin",
-                        EEPROM_APP_DIR,
-                        filename);
-
-                    // Save file
-                    Storage* storage = static_cast<Storage*>(furi_record_open(RECORD_STORAGE));
-                    File* file = storage_file_alloc(storage);
-
-                    bool success =
-                        storage_file_open(file, app->save_path, FSAM_WRITE, FSOM_CREATE_ALWAYS);
-
-                    if(success) {
-                        success =
-                            (storage_file_write(file, app->memory_data, app->memory_size) ==
-                             app->memory_size);
-
-                        if(success) {
-                            show_message(app, "File saved!", true);
-                        } else {
-                            show_message(app, "Write error!", false);
-                        }
+            if(app->dumping || app->summarizing || app->searching) {
+                // Dump, block summary or search in progress
+            } else if(app->find_editing) {
+                EEPROMPattern* pattern = &app->find_pattern;
+                uint8_t index = app->find_cursor / 2;
+                uint8_t shift = (app->find_cursor % 2) ? 0 : 4;
+                if(input_event->key == InputKeyUp || input_event->key == InputKeyDown) {
+                    // Digit runs 0-F, then ?? makes the whole byte a wildcard
+                    int8_t value =
+                        pattern->wild[index] ? -1 : (pattern->bytes[index] >> shift) & 0xF;
+                    if(input_event->key == InputKeyUp) {
+                        value = (value == 15) ? -1 : value + 1;
+                    } else {
+                        value = (value == -1) ? 15 : value - 1;
+                    }
+                    if(value < 0) {
+                        pattern->wild[index] = true;
+                        pattern->bytes[index] = 0;
                     } else {
-                        show_message(app, "Cannot create file!", false);
+                        if(pattern->wild[index]) pattern->bytes[index] = 0;
+                        pattern->wild[index] = false;
+                        pattern->bytes[index] =
+                            (pattern->bytes[index] & ~(0xF << shift)) | (value << shift);
                     }
+                } else if(input_event->key == InputKeyLeft) {
+                    if(app->find_cursor > 0) app->find_cursor--;
+                } else if(input_event->key == InputKeyRight) {
+                    // Moving past the last digit appends a byte
+                    if(app->find_cursor + 1 < pattern->length * 2) {
+                        app->find_cursor++;
+                    } else if(pattern->length < EEPROM_PATTERN_MAX) {
+                        pattern->bytes[pattern->length] = 0;
+                        pattern->wild[pattern->length] = false;
+                        pattern->length++;
+                        app->find_cursor++;
+                    }
+                } else if(input_event->key == InputKeyOk) {
+                    app->find_editing = false;
+                    app->find_found = false;
+                    viewer_find(app, false);
+                } else if(input_event->key == InputKeyBack) {
+                    app->find_editing = false;
+                }
+            } else if(app->goto_editing) {
+                uint8_t digits = address_digits(app);
+                uint8_t shift = 4 * (digits - 1 - app->goto_cursor);
+                uint32_t nibble = (app->goto_address >> shift) & 0xF;
+                if(input_event->key == InputKeyUp) {
+                    nibble = (nibble + 1) & 0xF;
+                } else if(input_event->key == InputKeyDown) {
+                    nibble = (nibble - 1) & 0xF;
+                } else if(input_event->key == InputKeyLeft) {
+                    if(app->goto_cursor > 0) app->goto_cursor--;
+                } else if(input_event->key == InputKeyRight) {
+                    if(app->goto_cursor < digits - 1) app->goto_cursor++;
+                } else if(input_event->key == InputKeyOk) {
+                    app->goto_editing = false;
+                    viewer_goto(app, app->goto_address);
+                } else if(input_event->key == InputKeyBack) {
+                    app->goto_editing = false;
+                }
+                app->goto_address = (app->goto_address & ~(0xFUL << shift)) | (nibble << shift);
+            } else if(input_event->key == InputKeyUp || input_event->key == InputKeyDown) {
+                // Held keys jump pages, twice as far on every repeat
+                uint32_t step = READ_VIEW_ROW_BYTES;
+                if(input_event->type == InputTypeRepeat) {
+                    uint32_t max_jump = app->memory_size / 8;
+                    if(app->view_jump < max_jump) app->view_jump *= 2;
+                    step = app->view_jump;
+                }
+                viewer_scroll(app, input_event->key == InputKeyDown, step);
+            } else if(input_event->key == InputKeyLeft) {
+                app->goto_editing = true;
+                app->goto_address = app->current_address;
+                app->goto_cursor = 0;
+            } else if(input_event->key == InputKeyRight) {
+                viewer_jump_data(app);
+            } else if(input_event->key == InputKeyOk) {
+                // Stream a dump to SD with auto-generated filename
+                ensure_app_directory(app);
+                char filename[64];
+                generate_filename(app, filename, sizeof(filename));
 
-                    storage_file_close(file);
-                    storage_file_free(file);
-                    furi_record_close(RECORD_STORAGE);
+                // Build full path
+                snprintf(
+                    app->save_path, sizeof(app->save_path), "%s/%s.bin", EEPROM_APP_DIR, filename);
 
-                    app->save_path[0] = '\0';
-                    app->read_completed = false;
-                } else {
-                    // Start read operation
-                    read_memory_range(app);
-                }
+                save_memory_to_file(app);
             } else if(input_event->key == InputKeyBack) {
                 app->current_state = AppState_Main;
-                app->read_completed = false; // Reset flag when leaving
             }
             break;
 
         case AppState_Write:
-            if(input_event->key == InputKeyUp) {
-                // Switch to address editing
-                app->write_cursor = 0;
-            } else if(input_event->key == InputKeyDown) {
-                // Switch to data editing
-                app->write_cursor = 1;
-            } else if(input_event->key == InputKeyRight) {
-                if(app->write_cursor == 0) {
-                    // Increase address
-                    if(app->write_start_addr < app->memory_size - 1) {
-                        app->write_start_addr++;
+            if(app->committing) {
+                // Pages are being written
+            } else if(input_event->key == InputKeyUp || input_event->key == InputKeyDown) {
+                // Change the digit under the cursor, once its byte is known
+                uint8_t value;
+                if(viewer_byte(app, app->edit_address, true, &value)) {
+                    uint8_t shift = app->edit_nibble ? 0 : 4;
+                    uint8_t step = (input_event->key == InputKeyUp) ? 1 : 0xF;
+                    uint8_t digit = ((value >> shift) + step) & 0xF;
+                    value = (value & ~(0xF << shift)) | (digit << shift);
+                    if(app->edits.size == 0) {
+                        show_message(app, "Page size too small to edit", false);
+                    } else if(!eeprom_edit_set(&app->edits, app->edit_address, value)) {
+                        show_message(app, "Too many edits, commit", false);
                     }
-                } else {
-                    // Increase data byte
-                    app->write_data[0]++;
                 }
             } else if(input_event->key == InputKeyLeft) {
-                if(app->write_cursor == 0) {
-                    // Decrease address
-                    if(app->write_start_addr > 0) {
-                        app->write_start_addr--;
-                    }
-                } else {
-                    // Decrease data byte
-                    app->write_data[0]--;
-                }
+                editor_move(app, -1);
+            } else if(input_event->key == InputKeyRight) {
+                editor_move(app, 1);
             } else if(input_event->key == InputKeyOk) {
-                // Write single byte to selected address
-                write_memory_data(app);
+                commit_edits(app);
             } else if(input_event->key == InputKeyBack) {
+                // Pending edits are kept for the next visit
                 app->current_state = AppState_Main;
             }
             break;
@@ -1250,18 +1779,13 @@ static void eeprom_input_callback(InputEvent* input_event, void* context) {
                     app->confirm_load_yes = true;
                 } else if(input_event->key == InputKeyRight) {
                     app->confirm_load_yes = false;
+                } else if(input_event->key == InputKeyUp) {
+                    // Compare chip with the file, nothing is written
+                    verify_file_data(app);
                 } else if(input_event->key == InputKeyOk) {
                     if(app->confirm_load_yes) {
                         // User confirmed YES - start async write to EEPROM with verification
-                        app->writing = true;
-                        app->write_current_addr_async = 0;
-                        app->write_total_bytes_async = app->file_size;
-                        app->write_last_update = furi_get_tick();
-                        app->show_progress = true;
-                        app->progress_value = 0;
-                        app->verifying = false;
-                        app->message_text[0] = '\0';
-                        app->show_message = false;
+                        write_file_data(app);
                         // Stay in ConfirmLoad state to show progress
                     } else {
                         // User selected NO - return to main menu
@@ -1284,6 +1808,10 @@ static void eeprom_input_callback(InputEvent* input_event, void* context) {
                     // User confirmed YES - delete the file
                     Storage* storage = static_cast<Storage*>(furi_record_open(RECORD_STORAGE));
                     if(storage_simply_remove(storage, app->file_path)) {
+                        // Checksum of a dump goes with it
+                        char crc_path[300];
+                        checksum_path(app->file_path, crc_path, sizeof(crc_path));
+                        storage_simply_remove(storage, crc_path);
                         show_message(app, "File deleted!", true);
                     } else {
                         show_message(app, "Delete failed!", false);
@@ -1434,11 +1962,47 @@ static void eeprom_input_callback(InputEvent* input_event, void* context) {
 
         case AppState_Erase:
             if(input_event->key == InputKeyOk) {
-                erase_memory_range(app, 0, app->memory_size);
+                erase_memory_range(app, app->range_start, range_length(app));
+            } else if(input_event->key == InputKeyBack) {
+                app->current_state = AppState_Main;
+            }
+            break;
+
+        case AppState_Range: {
+            uint32_t* values[3] = {&app->range_start, &app->range_end, &app->range_file_offset};
+            uint8_t digit;
+            uint8_t field = range_cursor_field(app, &digit);
+            uint8_t shift = 4 * (range_field_digits(app, field) - 1 - digit);
+            if(input_event->key == InputKeyUp || input_event->key == InputKeyDown) {
+                uint32_t nibble = (*values[field] >> shift) & 0xF;
+                nibble = (input_event->key == InputKeyUp) ? nibble + 1 : nibble - 1;
+                *values[field] = (*values[field] & ~(0xFUL << shift)) | ((nibble & 0xF) << shift);
+
+                // Keep start <= end inside the chip, the other end follows the edited one
+                uint32_t last = app->memory_size - 1;
+                if(app->range_start > last) app->range_start = last;
+                if(app->range_end > last) app->range_end = last;
+                if(app->range_start > app->range_end) {
+                    if(field == 0) {
+                        app->range_end = app->range_start;
+                    } else {
+                        app->range_start = app->range_end;
+                    }
+                }
+            } else if(input_event->key == InputKeyLeft) {
+                if(app->range_cursor > 0) app->range_cursor--;
+            } else if(input_event->key == InputKeyRight) {
+                uint8_t positions = address_digits(app) * 2 + RANGE_OFFSET_DIGITS;
+                if(app->range_cursor < positions - 1) app->range_cursor++;
+            } else if(input_event->key == InputKeyOk) {
+                app->range_start = 0;
+                app->range_end = app->memory_size - 1;
+                app->range_file_offset = 0;
             } else if(input_event->key == InputKeyBack) {
                 app->current_state = AppState_Main;
             }
             break;
+        }
 
         case AppState_Settings:
             if(input_event->key == InputKeyUp) {
@@ -1446,13 +2010,32 @@ static void eeprom_input_callback(InputEvent* input_event, void* context) {
             } else if(input_event->key == InputKeyDown) {
                 if(app->settings_cursor < SettingsItem_Count - 1) app->settings_cursor++;
             } else if(input_event->key == InputKeyLeft || input_event->key == InputKeyRight) {
-                if(app->settings_cursor == SettingsItem_Address) {
+                if(worker_busy(app)) {
+                    // EEPROM configuration is locked while the worker uses it
+                } else if(app->settings_cursor == SettingsItem_SmartWrite) {
+                    app->smart_write = !app->smart_write;
+                } else if(app->settings_cursor == SettingsItem_Gang) {
+                    app->gang_mode = !app->gang_mode;
+                } else if(app->settings_cursor == SettingsItem_BusSpeed) {
+                    if(input_event->key == InputKeyLeft) {
+                        if(app->bus_speed > BusSpeed_100k)
+                            app->bus_speed = (BusSpeed)(app->bus_speed - 1);
+                    } else {
+                        if(app->bus_speed < BusSpeed_Count - 1)
+                            app->bus_speed = (BusSpeed)(app->bus_speed + 1);
+                    }
+                    app->transport->setClock(bus_speed_clock[app->bus_speed]);
+                } else if(app->settings_cursor == SettingsItem_Address) {
                     if(input_event->key == InputKeyLeft) {
                         if(app->i2c_address > EEPROM_24C02_BASE_ADDR) app->i2c_address--;
                     } else {
                         if(app->i2c_address < EEPROM_24C02_MAX_ADDR) app->i2c_address++;
                     }
                     app->eeprom->setAddress(app->i2c_address);
+                    // Another chip: back to the table geometry, no cached data or edits
+                    app->geometry = get_eeprom_geometry(app->chip_type);
+                    app->chip_detected = false;
+                    apply_geometry(app);
                 } else if(app->settings_cursor == SettingsItem_ChipType) {
                     if(input_event->key == InputKeyLeft) {
                         if(app->chip_type > (EEPROMType)0)
@@ -1461,25 +2044,28 @@ static void eeprom_input_callback(InputEvent* input_event, void* context) {
                         if(app->chip_type < (EEPROMType)(EEPROMType_Count - 1))
                             app->chip_type = (EEPROMType)(app->chip_type + 1);
                     }
-                    // Reallocate buffers for new chip size
-                    reallocate_buffers(app);
+                    // Manual choice overrides detection until the next probe
+                    app->geometry = get_eeprom_geometry(app->chip_type);
+                    app->chip_detected = false;
+                    // Resize the viewer for the new chip
+                    apply_geometry(app);
                     // Reset current address if it's beyond new size
                     if(app->current_address >= app->memory_size) {
                         app->current_address = 0;
                     }
+                    if(app->edit_address >= app->memory_size) {
+                        app->edit_address = 0;
+                    }
                 }
             } else if(input_event->key == InputKeyOk) {
                 if(app->settings_cursor == SettingsItem_I2CScanner) {
                     // Launch I2C Scanner
                     scan_i2c_bus(app);
                     app->current_state = AppState_I2CScanner;
-                } else {
+                } else if(!worker_busy(app)) {
                     // Test connection
-                    app->eeprom_connected = app->eeprom->isAvailable();
-                    show_message(
-                        app,
-                        app->eeprom_connected ? "Connected!" : "Not Connected",
-                        app->eeprom_connected);
+                    app->probing = true;
+                    worker_send(app, WorkerCmd_Probe);
                 }
             } else if(input_event->key == InputKeyBack) {
                 app->current_state = AppState_Main;
@@ -1503,6 +2089,55 @@ static void eeprom_input_callback(InputEvent* input_event, void* context) {
     if(input_event->type == InputTypeLong && input_event->key == InputKeyBack) {
         app->running = false;
     }
+
+    // Long press in the editor moves a row, or drops all pending edits on OK
+    if(input_event->type == InputTypeLong && app->current_state == AppState_Write &&
+       !app->committing) {
+        if(input_event->key == InputKeyLeft || input_event->key == InputKeyRight) {
+            int32_t row = READ_VIEW_ROW_BYTES * 2;
+            editor_move(app, input_event->key == InputKeyRight ? row : -row);
+        } else if(input_event->key == InputKeyOk && app->edits.count > 0) {
+            eeprom_edit_reset(&app->edits, app->memory_size, app->geometry.page_size);
+            show_message(app, "Edits discarded", true);
+        }
+    }
+
+    if(input_event->type == InputTypeLong && app->current_state == AppState_Read &&
+       !app->dumping && !app->summarizing && !app->searching) {
+        if(app->find_editing) {
+            // Drop the byte under the cursor, one always stays
+            EEPROMPattern* pattern = &app->find_pattern;
+            uint8_t index = app->find_cursor / 2;
+            if(input_event->key == InputKeyLeft && pattern->length > 1) {
+                for(uint8_t i = index; i + 1 < pattern->length; i++) {
+                    pattern->bytes[i] = pattern->bytes[i + 1];
+                    pattern->wild[i] = pattern->wild[i + 1];
+                }
+                pattern->length--;
+                if(index >= pattern->length) index = pattern->length - 1;
+                app->find_cursor = index * 2;
+            }
+        } else if(!app->goto_editing) {
+            if(input_event->key == InputKeyUp || input_event->key == InputKeyDown) {
+                // Long press jumps a screen, repeats then accelerate
+                app->view_jump = READ_VIEW_BYTES;
+                viewer_scroll(app, input_event->key == InputKeyDown, app->view_jump);
+            } else if(input_event->key == InputKeyOk) {
+                if(app->find_pattern.length == 0) {
+                    viewer_find(app, false); // Opens the editor with a first byte
+                } else {
+                    app->find_editing = true;
+                    app->find_cursor = 0;
+                }
+            } else if(input_event->key == InputKeyRight) {
+                viewer_find(app, false);
+            } else if(input_event->key == InputKeyLeft) {
+                viewer_find(app, true);
+            }
+        }
+    }
+
+    furi_mutex_release(app->mutex);
 }
 
 // Show message function
@@ -1519,361 +2154,1185 @@ static void generate_filename(EEPROMApp* app, char* buffer, size_t buffer_size)
     DateTime datetime;
     furi_hal_rtc_get_datetime(&datetime);
 
-    const char* chip_name = "24C02";
-    switch(app->chip_type) {
-    case EEPROMType_24C01:
-        chip_name = "24C01";
-        break;
-    case EEPROMType_24C02:
-        chip_name = "24C02";
-        break;
-    case EEPROMType_24C04:
-        chip_name = "24C04";
-        break;
-    case EEPROMType_24C08:
-        chip_name = "24C08";
-        break;
-    case EEPROMType_24C16:
-        chip_name = "24C16";
-        break;
-    case EEPROMType_24C32:
-        chip_name = "24C32";
-        break;
-    case EEPROMType_24C64:
-        chip_name = "24C64";
-        break;
-    case EEPROMType_24C128:
-        chip_name = "24C128";
-        break;
-    case EEPROMType_24C256:
-        chip_name = "24C256";
-        break;
-    case EEPROMType_24C512:
-        chip_name = "24C512";
-        break;
-    default:
-        chip_name = "24C02";
-        break;
-    }
-
-    snprintf(
+    int length = snprintf(
         buffer,
         buffer_size,
         "%s_%04d-%02d-%02d_%02d-%02d",
-        chip_name,
+        get_eeprom_traits(app->chip_type).name,
         datetime.year,
         datetime.month,
         datetime.day,
         datetime.hour,
         datetime.minute);
+
+    // Partial dumps carry their range
+    if(!range_is_full(app) && length > 0 && (size_t)length < buffer_size) {
+        int digits = address_digits(app);
+        snprintf(
+            buffer + length,
+            buffer_size - length,
+            "_%0*lX-%0*lX",
+            digits,
+            app->range_start,
+            digits,
+            app->range_end);
+    }
 }
 
-// Process async erase step - called from draw callback
-static void process_erase_step(EEPROMApp* app) {
-    uint32_t current_time = furi_get_tick();
+// Check if worker is running an EEPROM operation (call with mutex held)
+static bool worker_busy(EEPROMApp* app) {
+    return app->fetching || app->summarizing || app->searching || app->committing ||
+           app->writing || app->verifying || app->erasing || app->scanning_i2c || app->dumping ||
+           app->probing;
+}
 
-    // Process one chunk every 50ms to show progress
-    if(current_time - app->erase_last_update >= 50) {
-        if(app->erase_current_addr >= app->memory_size) {
-            // Erase completed
-            app->erasing = false;
-            app->show_progress = false;
-            show_message(app, "Erase Success!", true);
-            return;
-        }
-        if(app->erase_current_addr >= app->memory_size) {
-            // Erase completed
-            app->erasing = false;
-            app->show_progress = false;
-            show_message(app, "Erase Success!", true);
-            return;
-        }
+// Queue command for worker thread
+static void worker_send(EEPROMApp* app, EEPROMWorkerCommandType type) {
+    EEPROMWorkerCommand command;
+    command.type = type;
+    furi_message_queue_put(app->worker_queue, &command, FuriWaitForever);
+}
 
-        // Erase one chunk
-        uint8_t chunk_size = (app->erase_current_addr + 8 <= app->memory_size) ?
-                                 8 :
-                                 (app->memory_size - app->erase_current_addr);
-        uint8_t erase_data[8];
+// Notify main loop that worker state changed (coalesced to one pending event)
+static void worker_notify(EEPROMApp* app) {
+    if(app->worker_event_pending) return;
+    app->worker_event_pending = true;
 
-        for(uint8_t j = 0; j < chunk_size; j++) {
-            erase_data[j] = 0xFF;
-        }
+    AppEvent event;
+    event.type = AppEventType_Worker;
+    if(furi_message_queue_put(app->event_queue, &event, 0) != FuriStatusOk) {
+        app->worker_event_pending = false;
+    }
+}
 
-        bool success = app->eeprom->writeBytes(app->erase_current_addr, erase_data, chunk_size);
-        if(!success) {
-            app->erasing = false;
-            app->show_progress = false;
-            show_message(app, "Erase Failed!", false);
-            return;
-        }
+// Publish operation progress to UI
+static void worker_publish_progress(EEPROMApp* app, uint32_t value) {
+    furi_mutex_acquire(app->mutex, FuriWaitForever);
+    app->progress_value = value;
+    furi_mutex_release(app->mutex);
+    worker_notify(app);
+}
 
-        // Update progress
-        app->erase_current_addr += chunk_size;
-        app->progress_value = app->erase_current_addr;
-        app->erase_last_update = current_time;
+// Bulk transfer progress - update UI without pausing the transfer
+static void worker_progress_callback(uint32_t done, uint32_t total, void* context) {
+    UNUSED(total);
+    worker_publish_progress(static_cast<EEPROMApp*>(context), done);
+}
+
+// Drop bus clock one step after a NACK or failed transfer; false once at 100 kHz
+static bool worker_fallback(EEPROMApp* app, EEPROMOpResult result) {
+    if(result != EEPROMOpReadError && result != EEPROMOpWriteError) return false;
+    if(app->worker_cancel) return false;
+
+    furi_mutex_acquire(app->mutex, FuriWaitForever);
+    bool lowered = app->bus_speed > BusSpeed_100k;
+    if(lowered) {
+        app->bus_speed = (BusSpeed)(app->bus_speed - 1);
+        app->transport->setClock(bus_speed_clock[app->bus_speed]);
+        app->progress_value = 0;
     }
+    furi_mutex_release(app->mutex);
+
+    return lowered;
 }
 
-// Process async read step - called from draw callback
-static void process_read_step(EEPROMApp* app) {
-    uint32_t current_time = furi_get_tick();
+// Writes also fall back when a page still reads back wrong; a verify mismatch is the data
+static bool worker_write_fallback(EEPROMApp* app, EEPROMOpResult result) {
+    return worker_fallback(app, (result == EEPROMOpMismatch) ? EEPROMOpWriteError : result);
+}
 
-    // Process one chunk every 30ms to show progress
-    if(current_time - app->read_last_update >= 30) {
-        if(app->read_current_addr >= app->read_total_bytes) {
-            // Read completed
-            app->reading = false;
-            app->show_progress = false;
-            app->read_completed = true; // Mark read as completed
-            show_message(app, "Read complete! Press OK to save.", true);
-            return;
-        }
+// Next page the viewer needs: visible rows first, then the pages ahead in the
+// scroll direction (app mutex held)
+static bool viewer_next_missing(EEPROMApp* app, uint32_t* base) {
+    uint32_t start = app->current_address;
+    uint32_t length = READ_VIEW_ROWS * READ_VIEW_ROW_BYTES;
+    if(eeprom_cache_next_missing(&app->cache, start, length, base)) return true;
 
-        // Read one chunk (16 bytes at a time for better performance)
-        uint8_t chunk_size = (app->read_current_addr + 16 <= app->read_total_bytes) ?
-                                 16 :
-                                 (app->read_total_bytes - app->read_current_addr);
+    uint32_t ahead = EEPROM_CACHE_PREFETCH * EEPROM_CACHE_PAGE_SIZE;
+    if(app->view_direction > 0) {
+        return eeprom_cache_next_missing(&app->cache, start + length, ahead, base);
+    }
+    if(start < ahead) ahead = start;
+    return eeprom_cache_next_missing(&app->cache, start - ahead, ahead, base);
+}
 
-        bool success = app->eeprom->readBytes(
-            app->read_current_addr, &app->memory_data[app->read_current_addr], chunk_size);
-        if(!success) {
-            app->reading = false;
-            app->show_progress = false;
+// Worker: read pages into the viewer cache until the window and prefetch are in
+// Follows current_address as it moves, so one command serves a whole scroll
+static void worker_fetch(EEPROMApp* app) {
+    uint8_t data[EEPROM_CACHE_PAGE_SIZE];
+    bool success = true;
+    while(success && !app->worker_cancel) {
+        uint32_t base;
+        furi_mutex_acquire(app->mutex, FuriWaitForever);
+        bool missing = viewer_next_missing(app, &base);
+        furi_mutex_release(app->mutex);
+        if(!missing) break;
+
+        do {
+            success = app->eeprom->readSequential(base, data, EEPROM_CACHE_PAGE_SIZE);
+        } while(!success && worker_fallback(app, EEPROMOpReadError));
+
+        furi_mutex_acquire(app->mutex, FuriWaitForever);
+        if(success) {
+            eeprom_cache_store(&app->cache, base, data);
+        } else {
             show_message(app, "Read Failed!", false);
-            return;
         }
+        furi_mutex_release(app->mutex);
+        worker_notify(app);
+    }
+
+    furi_mutex_acquire(app->mutex, FuriWaitForever);
+    app->fetching = false;
+    furi_mutex_release(app->mutex);
+}
 
-        // Update progress
-        app->read_current_addr += chunk_size;
-        app->progress_value = app->read_current_addr;
-        app->read_last_update = current_time;
+// Operation control: progress to UI, cancel on app exit
+static EEPROMOpControl worker_op_control(EEPROMApp* app) {
+    EEPROMOpControl control;
+    control.progress = worker_progress_callback;
+    control.context = app;
+    control.cancel = &app->worker_cancel;
+    return control;
+}
+
+// Worker: map which blocks hold data, then take the viewer to the next one
+static void worker_summary(EEPROMApp* app) {
+    EEPROMOpControl control = worker_op_control(app);
+    uint8_t summary[READ_SUMMARY_BYTES];
+    EEPROMOpResult result;
+    do {
+        result = eeprom_op_block_summary(app->eeprom, 0, app->memory_size, summary, &control);
+    } while(worker_fallback(app, result));
+
+    furi_mutex_acquire(app->mutex, FuriWaitForever);
+    app->summarizing = false;
+    app->show_progress = false;
+    if(result == EEPROMOpOk) {
+        memcpy(app->block_summary, summary, sizeof(summary));
+        app->summary_valid = true;
+        viewer_jump_data(app);
+    } else {
+        show_message(app, (result == EEPROMOpNoMemory) ? "Out of memory!" : "Read Failed!", false);
     }
+    furi_mutex_release(app->mutex);
+    worker_notify(app);
 }
 
-// Read memory range - start async read operation
-static bool read_memory_range(EEPROMApp* app) {
-    // Start async read of entire EEPROM
-    app->reading = true;
-    app->read_completed = false;
-    app->read_current_addr = 0;
-    app->read_last_update = furi_get_tick();
-    app->show_progress = true;
-    app->progress_value = 0;
-    app->read_total_bytes = app->memory_size; // Read entire EEPROM based on chip type
+// Worker: find the pattern on the side of find_from being searched, then wrap around
+static void worker_search(EEPROMApp* app) {
+    EEPROMOpControl control = worker_op_control(app);
+    furi_mutex_acquire(app->mutex, FuriWaitForever);
+    bool backward = app->find_backward;
+    uint32_t from = app->find_from;
+    uint32_t size = app->memory_size;
+    furi_mutex_release(app->mutex);
+
+    // Input leaves the pattern alone while searching
+    const EEPROMPattern* pattern = &app->find_pattern;
+
+    // Matches starting before from may run up to length - 1 bytes past it
+    uint32_t split = from + pattern->length - 1;
+    if(split > size) split = size;
+    uint32_t starts[2] = {from, 0};
+    uint32_t ends[2] = {size, split};
+    if(backward) {
+        starts[0] = 0;
+        ends[0] = split;
+        starts[1] = from;
+        ends[1] = size;
+    }
 
-    return true;
+    uint32_t match = 0;
+    EEPROMOpResult result = EEPROMOpNotFound;
+    for(uint8_t i = 0; i < 2 && result == EEPROMOpNotFound; i++) {
+        do {
+            result = eeprom_op_search(
+                app->eeprom,
+                starts[i],
+                ends[i] - starts[i],
+                pattern,
+                backward,
+                &match,
+                &control);
+        } while(worker_fallback(app, result));
+    }
+
+    furi_mutex_acquire(app->mutex, FuriWaitForever);
+    app->searching = false;
+    app->show_progress = false;
+    if(result == EEPROMOpOk) {
+        char text[24];
+        snprintf(text, sizeof(text), "Match at 0x%0*lX", address_digits(app), match);
+        app->find_found = true;
+        app->find_match = match;
+        viewer_goto(app, match);
+        show_message(app, text, true);
+    } else if(result == EEPROMOpNotFound) {
+        app->find_found = false;
+        show_message(app, "No match", false);
+    } else {
+        show_message(app, (result == EEPROMOpNoMemory) ? "Out of memory!" : "Read Failed!", false);
+    }
+    furi_mutex_release(app->mutex);
+    worker_notify(app);
 }
 
-// Async write step with verification
-static void process_write_step(EEPROMApp* app) {
-    uint32_t current_time = furi_get_tick();
-
-    // If verifying, process verification step
-    if(app->verifying) {
-        if(current_time - app->verify_last_update >= 30) {
-            if(app->verify_current_addr >= app->verify_total_bytes) {
-                // Verification read completed - now compare
-                bool verified = true;
-                for(uint8_t i = 0; i < app->verify_total_bytes; i++) {
-                    if(app->verify_buffer[i] != app->file_data[i]) {
-                        verified = false;
-                        break;
-                    }
-                }
+// Worker: erase op_start/op_length, skipping pages that are already blank
+static void worker_erase(EEPROMApp* app) {
+    EEPROMOpControl control = worker_op_control(app);
+    uint32_t start = app->op_start;
+    uint32_t length = app->op_length;
+    EEPROMEraseStats stats;
+    EEPROMOpResult result;
+    do {
+        result = eeprom_op_erase(app->eeprom, start, length, &control, &stats);
+    } while(worker_fallback(app, result));
+
+    const char* message = "Erase Success!";
+    if(result == EEPROMOpReadError) {
+        message = "Erase read failed!";
+    } else if(result == EEPROMOpNoMemory) {
+        message = "Out of memory!";
+    } else if(result != EEPROMOpOk) {
+        message = "Erase Failed!";
+    }
 
-                if(verified) {
-                    show_message(app, "Success!", true);
-                    // Copy file data to memory display
-                    memcpy(app->memory_data, app->file_data, app->verify_total_bytes);
-                } else {
-                    show_message(app, "Verify Failed!", false);
-                }
+    furi_mutex_acquire(app->mutex, FuriWaitForever);
+    app->erasing = false;
+    app->show_progress = false;
+    app->erase_pages_erased = stats.pages_erased;
+    app->erase_pages_skipped = stats.pages_skipped;
+    viewer_invalidate(app, start, length);
+    if(result == EEPROMOpOk && start == 0 && length == app->memory_size) {
+        // Every block is blank now
+        memset(app->block_summary, 0, sizeof(app->block_summary));
+        app->summary_valid = true;
+    }
+    show_message(app, message, result == EEPROMOpOk);
+    furi_mutex_release(app->mutex);
+}
 
-                app->verifying = false;
-                app->writing = false;
-                app->show_progress = false;
-                return;
-            }
+// Checksum file stored next to a dump
+static void checksum_path(const char* path, char* buffer, size_t buffer_size) {
+    snprintf(buffer, buffer_size, "%s" EEPROM_CRC32_SUFFIX, path);
+}
 
-            // Read one verification chunk (16 bytes at a time)
-            uint8_t chunk_size = (app->verify_current_addr + 16 <= app->verify_total_bytes) ?
-                                     16 :
-                                     (app->verify_total_bytes - app->verify_current_addr);
-
-            bool success = app->eeprom->readBytes(
-                app->verify_current_addr,
-                &app->verify_buffer[app->verify_current_addr],
-                chunk_size);
-
-            if(!success) {
-                app->verifying = false;
-                app->writing = false;
-                app->show_progress = false;
-                show_message(app, "Verify read failed!", false);
-                return;
-            }
+static bool checksum_save(Storage* storage, const char* path, uint32_t crc, uint32_t length) {
+    char crc_path[300];
+    char record[EEPROM_CRC32_RECORD_SIZE];
+    checksum_path(path, crc_path, sizeof(crc_path));
+    size_t record_length = eeprom_crc32_record_format(record, sizeof(record), crc, length);
 
-            // Update verify progress
-            app->verify_current_addr += chunk_size;
-            app->progress_value = app->verify_current_addr;
-            app->verify_last_update = current_time;
-        }
-        return;
+    File* file = storage_file_alloc(storage);
+    bool success = storage_file_open(file, crc_path, FSAM_WRITE, FSOM_CREATE_ALWAYS) &&
+                   storage_file_write(file, record, record_length) == record_length;
+    storage_file_close(file);
+    storage_file_free(file);
+    return success;
+}
+
+// False when path has no checksum file or it cannot be parsed
+static bool checksum_load(Storage* storage, const char* path, uint32_t* crc, uint32_t* length) {
+    char crc_path[300];
+    char record[EEPROM_CRC32_RECORD_SIZE];
+    checksum_path(path, crc_path, sizeof(crc_path));
+
+    File* file = storage_file_alloc(storage);
+    bool success = storage_file_open(file, crc_path, FSAM_READ, FSOM_OPEN_EXISTING);
+    if(success) {
+        size_t read = storage_file_read(file, record, sizeof(record) - 1);
+        record[read] = '\0';
+        success = eeprom_crc32_record_parse(record, crc, length);
     }
+    storage_file_close(file);
+    storage_file_free(file);
+    return success;
+}
 
-    // Process write step
-    if(current_time - app->write_last_update >= 30) {
-        if(app->write_current_addr_async >= app->write_total_bytes_async) {
-            // Write completed - start verification
-            app->writing = false;
-            app->verifying = true;
-            app->verify_current_addr = 0;
-            app->verify_total_bytes = app->write_total_bytes_async;
-            app->verify_last_update = furi_get_tick();
-            app->progress_value = 0;
-            return;
+// Source callback streaming an open SD file
+static bool file_source_read(void* context, uint8_t* buffer, uint32_t length) {
+    return storage_file_read(static_cast<File*>(context), buffer, length) == length;
+}
+
+// Open file_path for streaming (worker side)
+static File* worker_open_file(EEPROMApp* app, Storage* storage) {
+    char file_path[256];
+    furi_mutex_acquire(app->mutex, FuriWaitForever);
+    strncpy(file_path, app->file_path, sizeof(file_path) - 1);
+    file_path[sizeof(file_path) - 1] = '\0';
+    furi_mutex_release(app->mutex);
+
+    File* file = storage_file_alloc(storage);
+    if(!storage_file_open(file, file_path, FSAM_READ, FSOM_OPEN_EXISTING)) {
+        storage_file_free(file);
+        return nullptr;
+    }
+
+    return file;
+}
+
+// Checksum stored with file_path, if it covers length bytes (worker side)
+static bool worker_file_checksum(EEPROMApp* app, Storage* storage, uint32_t length, uint32_t* crc) {
+    char file_path[256];
+    furi_mutex_acquire(app->mutex, FuriWaitForever);
+    strncpy(file_path, app->file_path, sizeof(file_path) - 1);
+    file_path[sizeof(file_path) - 1] = '\0';
+    furi_mutex_release(app->mutex);
+
+    uint32_t stored_length;
+    return checksum_load(storage, file_path, crc, &stored_length) && stored_length == length;
+}
+
+// CRC32 of length file bytes from the current position, SD only (worker side)
+static EEPROMOpResult worker_file_crc(File* file, uint32_t length, uint32_t* crc) {
+    uint8_t* chunk = static_cast<uint8_t*>(malloc(EEPROM_OP_VERIFY_CHUNK));
+    if(chunk == nullptr) return EEPROMOpNoMemory;
+    bool success = true;
+    *crc = EEPROM_CRC32_INIT;
+    for(uint32_t done = 0; success && done < length;) {
+        uint32_t chunk_size = length - done;
+        if(chunk_size > EEPROM_OP_VERIFY_CHUNK) chunk_size = EEPROM_OP_VERIFY_CHUNK;
+        success = file_source_read(file, chunk, chunk_size);
+        *crc = eeprom_crc32(*crc, chunk, chunk_size);
+        done += chunk_size;
+    }
+    free(chunk);
+    return success ? EEPROMOpOk : EEPROMOpSourceError;
+}
+
+// Worker: stream file_path to EEPROM page by page, each page read back right after its write
+static void worker_write(EEPROMApp* app) {
+    uint32_t start = app->op_start;
+    uint32_t offset = app->op_file_offset;
+    uint32_t total = app->write_total_bytes_async;
+    const char* message = "File not found!";
+
+    Storage* storage = static_cast<Storage*>(furi_record_open(RECORD_STORAGE));
+    File* file = worker_open_file(app, storage);
+
+    // Checksum saved with the dump, if any, is checked against the file before the chip is
+    // touched, and against the streamed data in case the file changes while it is written
+    uint32_t stored_crc;
+    bool has_crc = worker_file_checksum(app, storage, total, &stored_crc);
+
+    bool success = false;
+    char failed_str[32];
+    EEPROMWriteStats stats;
+    memset(&stats, 0, sizeof(stats));
+    bool file_ok = (file != nullptr);
+    if(file_ok && has_crc) {
+        // SD pre-pass, no bus time: a corrupt file never reaches the chip
+        uint32_t file_crc;
+        storage_file_seek(file, offset, true);
+        EEPROMOpResult result = worker_file_crc(file, total, &file_crc);
+        if(result != EEPROMOpOk) {
+            message = (result == EEPROMOpNoMemory) ? "Out of memory!" : "File read error!";
+            file_ok = false;
+        } else if(file_crc != stored_crc) {
+            message = "File CRC mismatch!";
+            file_ok = false;
+        }
+    }
+    if(file_ok) {
+        EEPROMOpControl control = worker_op_control(app);
+        EEPROMOpResult result;
+        do {
+            // Smart write makes a retry only touch pages that did not make it
+            storage_file_seek(file, offset, true);
+            result = eeprom_op_write(
+                app->eeprom,
+                start,
+                total,
+                file_source_read,
+                file,
+                app->smart_write,
+                true,
+                nullptr,
+                &control,
+                &stats);
+        } while(worker_write_fallback(app, result));
+        // Chip holds the file, but the file is no longer what was dumped
+        bool crc_mismatch = (result == EEPROMOpOk && has_crc && stats.crc != stored_crc);
+        success = (result == EEPROMOpOk && !crc_mismatch);
+
+        switch(result) {
+        case EEPROMOpOk:
+            message = "Success!";
+            break;
+        case EEPROMOpSourceError:
+            message = "File read error!";
+            break;
+        case EEPROMOpMismatch:
+            snprintf(
+                failed_str, sizeof(failed_str), "%lu bytes wrong", stats.bytes_failed);
+            message = failed_str;
+            break;
+        case EEPROMOpNoMemory:
+            message = "Out of memory!";
+            break;
+        default:
+            message = "Write Failed!";
+            break;
         }
+        if(crc_mismatch) message = "File CRC mismatch!";
+    }
+    if(file) {
+        storage_file_close(file);
+        storage_file_free(file);
+    }
+    furi_record_close(RECORD_STORAGE);
+
+    furi_mutex_acquire(app->mutex, FuriWaitForever);
+    app->writing = false;
+    app->show_progress = false;
+    app->write_stats = stats;
+    viewer_invalidate(app, start, total);
+    show_message(app, message, success);
+    furi_mutex_release(app->mutex);
+}
 
-        // Write one chunk (4 bytes at a time for EEPROM page write)
-        uint8_t chunk_size = (app->write_current_addr_async + 4 <= app->write_total_bytes_async) ?
-                                 4 :
-                                 (app->write_total_bytes_async - app->write_current_addr_async);
+// Worker: compare EEPROM with file_path
+// With a stored checksum the chip is read once and the file only if the CRC32 differs;
+// the chunked compare then locates the differing bytes. Read errors are retried at lower
+// bus clocks; differing data is reported as is, without touching the bus speed
+static void worker_verify(EEPROMApp* app) {
+    uint32_t start = app->op_start;
+    uint32_t offset = app->op_file_offset;
+    uint32_t total = app->verify_total_bytes;
+    const char* message = "File not found!";
 
-        bool success = app->eeprom->writeBytes(
-            app->write_current_addr_async,
-            &app->file_data[app->write_current_addr_async],
-            chunk_size);
-        if(!success) {
-            app->writing = false;
-            app->show_progress = false;
-            show_message(app, "Write Failed!", false);
-            return;
+    Storage* storage = static_cast<Storage*>(furi_record_open(RECORD_STORAGE));
+    File* file = worker_open_file(app, storage);
+
+    bool verified = false;
+    EEPROMVerifyStats stats;
+    memset(&stats, 0, sizeof(stats));
+    if(file) {
+        uint32_t stored_crc;
+        bool has_crc = worker_file_checksum(app, storage, total, &stored_crc);
+
+        EEPROMOpControl control = worker_op_control(app);
+        EEPROMOpResult result = EEPROMOpMismatch;
+        if(has_crc) {
+            do {
+                result = eeprom_op_verify_crc(
+                    app->eeprom, start, total, stored_crc, nullptr, &control, &stats);
+            } while(worker_fallback(app, result));
+        }
+        if(result == EEPROMOpMismatch) {
+            do {
+                storage_file_seek(file, offset, true);
+                result = eeprom_op_verify(
+                    app->eeprom,
+                    start,
+                    total,
+                    file_source_read,
+                    file,
+                    nullptr,
+                    &control,
+                    &stats);
+            } while(worker_fallback(app, result));
+        }
+        verified = (result == EEPROMOpOk);
+
+        switch(result) {
+        case EEPROMOpReadError:
+            message = "Verify read failed!";
+            break;
+        case EEPROMOpSourceError:
+            message = "File read error!";
+            break;
+        case EEPROMOpMismatch:
+            message = "Verify Failed!";
+            break;
+        case EEPROMOpNoMemory:
+            message = "Out of memory!";
+            break;
+        default:
+            message = "Success!";
+            break;
         }
 
-        // Update progress
-        app->write_current_addr_async += chunk_size;
-        app->progress_value = app->write_current_addr_async;
-        app->write_last_update = current_time;
+        storage_file_close(file);
+        storage_file_free(file);
     }
+    furi_record_close(RECORD_STORAGE);
+
+    furi_mutex_acquire(app->mutex, FuriWaitForever);
+    show_message(app, message, verified);
+    app->verify_stats = stats;
+    app->verifying = false;
+    app->show_progress = false;
+    furi_mutex_release(app->mutex);
 }
 
-// Write memory data
-static bool write_memory_data(EEPROMApp* app) {
-    // Write single byte to selected address
-    bool success = app->eeprom->writeBytes(app->write_start_addr, app->write_data, 1);
-    char msg[64];
-    if(app->memory_size <= 256) {
-        snprintf(
-            msg,
-            sizeof(msg),
-            "Write 0x%02X to 0x%02lX %s",
-            app->write_data[0],
-            app->write_start_addr,
-            success ? "OK" : "FAIL");
-    } else {
+// Worker: write the pages holding editor changes
+static void worker_commit(EEPROMApp* app) {
+    EEPROMOpControl control = worker_op_control(app);
+
+    // The commit drops pages from a copy; the draw callback keeps reading app->edits
+    EEPROMEditBuffer* edits = static_cast<EEPROMEditBuffer*>(malloc(sizeof(EEPROMEditBuffer)));
+    EEPROMWriteStats stats;
+    memset(&stats, 0, sizeof(stats));
+    EEPROMOpResult result = EEPROMOpNoMemory;
+    uint32_t first = 0;
+    uint32_t last = 0;
+    if(edits) {
+        furi_mutex_acquire(app->mutex, FuriWaitForever);
+        memcpy(edits, &app->edits, sizeof(EEPROMEditBuffer));
+        furi_mutex_release(app->mutex);
+
+        // Span of the touched pages, for the viewer to read them again
+        eeprom_edit_next_dirty(edits, 0, &first);
+        for(uint32_t page = first; eeprom_edit_next_dirty(edits, page, &page); page++) {
+            last = page;
+        }
+
+        do {
+            result = eeprom_op_commit(app->eeprom, edits, &control, &stats);
+        } while(worker_write_fallback(app, result));
+    }
+
+    char msg[32];
+    switch(result) {
+    case EEPROMOpOk:
         snprintf(
             msg,
             sizeof(msg),
-            "Write 0x%02X->%04lX %s",
-            app->write_data[0],
-            app->write_start_addr,
-            success ? "OK" : "FAIL");
+            "Wrote %lu pages, %lu same",
+            stats.pages_written,
+            stats.pages_skipped);
+        break;
+    case EEPROMOpMismatch:
+        snprintf(msg, sizeof(msg), "%lu bytes wrong", stats.bytes_failed);
+        break;
+    case EEPROMOpNoMemory:
+        snprintf(msg, sizeof(msg), "Out of memory!");
+        break;
+    default:
+        snprintf(msg, sizeof(msg), "Write Failed!");
+        break;
     }
-    show_message(app, msg, success);
-    return success;
+
+    furi_mutex_acquire(app->mutex, FuriWaitForever);
+    if(edits) {
+        // Pages that made it to the chip are no longer pending
+        for(uint32_t page = first;
+            eeprom_edit_next_dirty(&app->edits, page, &page) && page <= last;
+            page++) {
+            uint32_t pending;
+            if(!eeprom_edit_next_dirty(edits, page, &pending) || pending != page) {
+                eeprom_edit_drop_page(&app->edits, page);
+            }
+        }
+        uint16_t page_size = app->edits.page_size;
+        viewer_invalidate(app, first * page_size, (last - first + 1) * page_size);
+    }
+    app->committing = false;
+    show_message(app, msg, result == EEPROMOpOk);
+    viewer_fetch(app);
+    furi_mutex_release(app->mutex);
+    free(edits);
 }
 
-// Erase memory range - start async erase operation
-static bool erase_memory_range(EEPROMApp* app, uint8_t start_addr, uint8_t length) {
-    UNUSED(start_addr);
-    UNUSED(length);
+// Switch to detected chip; false if no table entry matches (app mutex held)
+static bool apply_detected_geometry(EEPROMApp* app, const EEPROMGeometry& detected) {
+    for(int i = 0; i < EEPROMType_Count; i++) {
+        const EEPROMGeometry& geometry = eeprom_chip_traits[i].geometry;
+        if(geometry.size != detected.size || geometry.address_bytes != detected.address_bytes) {
+            continue;
+        }
 
-    // Start async erase
-    app->erasing = true;
-    app->erase_current_addr = 0;
-    app->erase_last_update = furi_get_tick();
-    app->show_progress = true;
-    app->progress_value = 0;
+        // Keep table tWR, page size as measured (differs between vendors)
+        app->chip_type = (EEPROMType)i;
+        app->geometry = geometry;
+        app->geometry.page_size = detected.page_size;
+        app->chip_detected = true;
+        apply_geometry(app);
+        if(app->current_address >= app->memory_size) {
+            app->current_address = 0;
+        }
+        if(app->edit_address >= app->memory_size) {
+            app->edit_address = 0;
+        }
+        return true;
+    }
 
-    return true;
+    return false;
 }
 
-// Scan I2C bus for devices
-static void scan_i2c_bus(EEPROMApp* app) {
-    app->i2c_device_count = 0;
-
-    // Clear previous results
-    for(uint8_t i = 0; i < 128; i++) {
-        app->i2c_devices[i] = false;
+// Worker: check if EEPROM responds and identify it
+static void worker_probe(EEPROMApp* app) {
+    bool connected = app->eeprom->isAvailable();
+    EEPROMGeometry detected;
+    bool found = connected && app->eeprom->detectGeometry(detected);
+
+    furi_mutex_acquire(app->mutex, FuriWaitForever);
+    app->eeprom_connected = connected;
+    if(found && apply_detected_geometry(app, detected)) {
+        char msg[32];
+        snprintf(msg, sizeof(msg), "Detected %s", get_eeprom_traits(app->chip_type).name);
+        show_message(app, msg, true);
+    } else {
+        // Driver still has the previous geometry
+        show_message(app, connected ? "Connected!" : "Not Connected", connected);
     }
+    app->probing = false;
+    furi_mutex_release(app->mutex);
+}
+
+// Worker: scan I2C bus for devices
+static void worker_scan(EEPROMApp* app) {
+    bool devices[128] = {false};
+    uint8_t device_count = 0;
 
     // Scan all possible I2C addresses (7-bit: 0x00-0x7F)
     for(uint8_t addr = 0x08; addr < 0x78; addr++) {
         // Try to communicate with device at this address
-        furi_hal_i2c_acquire(&furi_hal_i2c_handle_external);
-
-        bool device_found = furi_hal_i2c_is_device_ready(
-            &furi_hal_i2c_handle_external,
-            addr << 1, // Convert to 8-bit address
-            10);
-
-        furi_hal_i2c_release(&furi_hal_i2c_handle_external);
+        app->transport->acquire();
+        bool device_found = app->transport->isDeviceReady(addr << 1, 10); // 8-bit address
+        app->transport->release();
 
         if(device_found) {
-            app->i2c_devices[addr] = true;
-            app->i2c_device_count++;
+            devices[addr] = true;
+            device_count++;
         }
     }
+
+    furi_mutex_acquire(app->mutex, FuriWaitForever);
+    memcpy(app->i2c_devices, devices, sizeof(app->i2c_devices));
+    app->i2c_device_count = device_count;
+    app->scanning_i2c = false;
+    furi_mutex_release(app->mutex);
 }
 
-// Save memory to file
-static bool save_memory_to_file(EEPROMApp* app) {
+// Worker: stream file_path to every chip on 0x50-0x57 at once, then verify each
+static void worker_gang_write(EEPROMApp* app) {
+    uint32_t start = app->op_start;
+    uint32_t offset = app->op_file_offset;
+    uint32_t total = app->write_total_bytes_async;
+
+    // Fresh scan, chips with block select bits take several addresses
+    worker_scan(app);
+    EEPROMGang gang;
+    gang.count = 0;
+    furi_mutex_acquire(app->mutex, FuriWaitForever);
+    uint8_t step = 1 << app->geometry.block_bits;
+    for(uint8_t addr = EEPROM_24C02_BASE_ADDR; addr <= EEPROM_24C02_MAX_ADDR; addr += step) {
+        if(app->i2c_devices[addr]) {
+            gang.addresses[gang.count] = addr;
+            gang.results[gang.count] = EEPROMOpOk;
+            gang.count++;
+        }
+    }
+    furi_mutex_release(app->mutex);
+
     Storage* storage = static_cast<Storage*>(furi_record_open(RECORD_STORAGE));
-    File* file = storage_file_alloc(storage);
+    File* file = (gang.count > 0) ? worker_open_file(app, storage) : nullptr;
+
+    EEPROMOpResult result = EEPROMOpSourceError;
+    EEPROMWriteStats stats;
+    memset(&stats, 0, sizeof(stats));
+    if(file) {
+        EEPROMOpControl control = worker_op_control(app);
+        storage_file_seek(file, offset, true);
+        result = eeprom_op_gang_write(
+            app->eeprom,
+            &gang,
+            start,
+            total,
+            file_source_read,
+            file,
+            app->smart_write,
+            &control,
+            &stats);
+
+        if(result == EEPROMOpOk || result == EEPROMOpWriteError) {
+            furi_mutex_acquire(app->mutex, FuriWaitForever);
+            app->writing = false;
+            app->verifying = true;
+            app->verify_total_bytes = total;
+            app->progress_value = 0;
+            furi_mutex_release(app->mutex);
 
-    // Read entire EEPROM memory
-    bool success = app->eeprom->readBytes(0, app->memory_data, app->memory_size);
+            storage_file_seek(file, offset, true);
+            result = eeprom_op_gang_verify(
+                app->eeprom, &gang, start, total, file_source_read, file, &control);
+        }
 
-    if(success) {
-        ensure_app_directory(app);
+        storage_file_close(file);
+        storage_file_free(file);
+    }
+    furi_record_close(RECORD_STORAGE);
 
-        // Use provided path or generate default filename
-        const char* save_path = app->save_path;
-        if(save_path[0] == '\0') {
-            // Generate default filename with timestamp
-            char default_filename[64];
-            snprintf(
-                default_filename,
-                sizeof(default_filename),
-                EEPROM_APP_DIR "/eeprom_backup_%lu.bin",
-                (unsigned long)furi_get_tick());
-            save_path = default_filename;
+    uint8_t passed = 0;
+    for(uint8_t i = 0; i < gang.count; i++) {
+        if(gang.results[i] == EEPROMOpOk) passed++;
+    }
+
+    furi_mutex_acquire(app->mutex, FuriWaitForever);
+    app->writing = false;
+    app->verifying = false;
+    app->show_progress = false;
+    app->write_stats = stats;
+    viewer_invalidate(app, start, total);
+    if(gang.count == 0) {
+        show_message(app, "No EEPROM found!", false);
+    } else if(result == EEPROMOpSourceError || result == EEPROMOpCancelled) {
+        show_message(app, (result == EEPROMOpCancelled) ? "Cancelled" : "File read error!", false);
+    } else if(result == EEPROMOpNoMemory) {
+        show_message(app, "Out of memory!", false);
+    } else {
+        // Per-chip results go to the completion screen
+        app->gang = gang;
+        char msg[32];
+        snprintf(msg, sizeof(msg), "%u/%u chips OK", passed, gang.count);
+        show_message(app, msg, passed == gang.count);
+    }
+    furi_mutex_release(app->mutex);
+}
+
+// Dump writer thread - drains filled buffers to SD card
+static int32_t dump_writer_thread(void* context) {
+    DumpPipeline* pipeline = static_cast<DumpPipeline*>(context);
+    DumpBlock block;
+
+    while(furi_message_queue_get(pipeline->full_queue, &block, FuriWaitForever) ==
+          FuriStatusOk) {
+        if(block.length == 0) break;
+
+        if(!pipeline->write_error &&
+           storage_file_write(pipeline->file, pipeline->buffers[block.index], block.length) !=
+               block.length) {
+            pipeline->write_error = true;
         }
 
-        success = storage_file_open(file, save_path, FSAM_WRITE, FSOM_CREATE_ALWAYS);
+        furi_message_queue_put(pipeline->free_queue, &block, FuriWaitForever);
+    }
 
-        if(success) {
-            success =
-                (storage_file_write(file, app->memory_data, app->memory_size) == app->memory_size);
+    return 0;
+}
 
-            if(success) {
-                show_message(app, "Memory saved!", true);
-                app->current_state = AppState_Main;
-            } else {
-                show_message(app, "Write error!", false);
-            }
-        } else {
-            show_message(app, "Cannot create file!", false);
+// Dump sink: wait for a buffer the writer is done with
+static uint8_t* dump_sink_acquire(void* context) {
+    DumpPipeline* pipeline = static_cast<DumpPipeline*>(context);
+    DumpBlock block;
+    furi_message_queue_get(pipeline->free_queue, &block, FuriWaitForever);
+    return pipeline->buffers[block.index];
+}
+
+// Dump sink: hand filled buffer to the writer thread
+static bool dump_sink_submit(void* context, uint8_t* buffer, uint32_t length) {
+    DumpPipeline* pipeline = static_cast<DumpPipeline*>(context);
+    DumpBlock block;
+    block.index = (buffer == pipeline->buffers[0]) ? 0 : 1;
+    block.length = length;
+    furi_message_queue_put(pipeline->full_queue, &block, FuriWaitForever);
+    return !pipeline->write_error;
+}
+
+// Stream EEPROM into open file - I2C reads overlap with SD writes
+// CRC32 of the dumped data goes to crc, SD write failures end as EEPROMOpSinkError
+static EEPROMOpResult
+    dump_stream(EEPROMApp* app, File* file, uint32_t start, uint32_t total, uint32_t* crc) {
+    DumpPipeline pipeline;
+    pipeline.file = file;
+    pipeline.write_error = false;
+    pipeline.buffers[0] = static_cast<uint8_t*>(malloc(EEPROM_OP_DUMP_CHUNK * 2));
+    if(pipeline.buffers[0] == nullptr) return EEPROMOpNoMemory;
+    pipeline.buffers[1] = pipeline.buffers[0] + EEPROM_OP_DUMP_CHUNK;
+    pipeline.full_queue = furi_message_queue_alloc(2, sizeof(DumpBlock));
+    pipeline.free_queue = furi_message_queue_alloc(2, sizeof(DumpBlock));
+
+    DumpBlock block;
+    for(uint8_t i = 0; i < 2; i++) {
+        block.index = i;
+        block.length = 0;
+        furi_message_queue_put(pipeline.free_queue, &block, FuriWaitForever);
+    }
+
+    FuriThread* writer =
+        furi_thread_alloc_ex("EEPROMDumpWriter", 2 * 1024, dump_writer_thread, &pipeline);
+    furi_thread_start(writer);
+
+    EEPROMDumpSink sink;
+    sink.acquire = dump_sink_acquire;
+    sink.submit = dump_sink_submit;
+    sink.context = &pipeline;
+    EEPROMOpControl control = worker_op_control(app);
+    EEPROMOpResult result = eeprom_op_dump(app->eeprom, start, total, &sink, crc, &control);
+
+    // End of stream - writer drains remaining buffers first
+    block.length = 0;
+    furi_message_queue_put(pipeline.full_queue, &block, FuriWaitForever);
+    furi_thread_join(writer);
+    furi_thread_free(writer);
+
+    furi_message_queue_free(pipeline.full_queue);
+    furi_message_queue_free(pipeline.free_queue);
+    free(pipeline.buffers[0]);
+
+    return pipeline.write_error ? EEPROMOpSinkError : result;
+}
+
+// Worker: stream op_start/op_length of the EEPROM to save_path
+static void worker_dump(EEPROMApp* app) {
+    uint32_t start = app->op_start;
+    uint32_t length = app->op_length;
+    char save_path[256];
+    furi_mutex_acquire(app->mutex, FuriWaitForever);
+    strncpy(save_path, app->save_path, sizeof(save_path) - 1);
+    save_path[sizeof(save_path) - 1] = '\0';
+    furi_mutex_release(app->mutex);
+
+    ensure_app_directory(app);
+
+    // Use provided path or generate default filename
+    if(save_path[0] == '\0') {
+        snprintf(
+            save_path,
+            sizeof(save_path),
+            EEPROM_APP_DIR "/eeprom_backup_%lu.bin",
+            (unsigned long)furi_get_tick());
+    }
+
+    Storage* storage = static_cast<Storage*>(furi_record_open(RECORD_STORAGE));
+    File* file = storage_file_alloc(storage);
+    const char* message = "Memory saved!";
+
+    bool success = storage_file_open(file, save_path, FSAM_WRITE, FSOM_CREATE_ALWAYS);
+
+    uint32_t crc = 0;
+    if(success) {
+        EEPROMOpResult result;
+        do {
+            storage_file_seek(file, 0, true);
+            storage_file_truncate(file);
+            result = dump_stream(app, file, start, length, &crc);
+        } while(worker_fallback(app, result));
+        success = (result == EEPROMOpOk);
+        if(result == EEPROMOpSinkError) {
+            message = "Write error!";
+        } else if(result == EEPROMOpNoMemory) {
+            message = "Out of memory!";
+        } else if(!success) {
+            message = "Read error!";
         }
     } else {
-        show_message(app, "Read error!", false);
+        message = "Cannot create file!";
     }
 
     storage_file_close(file);
     storage_file_free(file);
+
+    // Checksum travels with the dump for verify and later loads
+    char crc_message[32];
+    if(success) {
+        if(checksum_save(storage, save_path, crc, length)) {
+            snprintf(crc_message, sizeof(crc_message), "Saved, CRC32 %08lX", crc);
+            message = crc_message;
+        } else {
+            message = "Saved, no .crc32 file!";
+        }
+    }
     furi_record_close(RECORD_STORAGE);
 
-    return success;
+    furi_mutex_acquire(app->mutex, FuriWaitForever);
+    app->dumping = false;
+    app->show_progress = false;
+    show_message(app, message, success);
+    // Read screen keeps showing its data after saving
+    if(success && app->current_state != AppState_Read) {
+        app->current_state = AppState_Main;
+    }
+    furi_mutex_release(app->mutex);
+}
+
+// Worker thread - owns the EEPROM, executes queued commands
+static int32_t eeprom_worker_thread(void* context) {
+    EEPROMApp* app = static_cast<EEPROMApp*>(context);
+    EEPROMWorkerCommand command;
+
+    while(true) {
+        if(furi_message_queue_get(app->worker_queue, &command, FuriWaitForever) !=
+           FuriStatusOk) {
+            continue;
+        }
+        if(command.type == WorkerCmd_Stop) break;
+
+        switch(command.type) {
+        case WorkerCmd_Fetch:
+            worker_fetch(app);
+            break;
+        case WorkerCmd_Summary:
+            worker_summary(app);
+            break;
+        case WorkerCmd_Search:
+            worker_search(app);
+            break;
+        case WorkerCmd_Write:
+            worker_write(app);
+            break;
+        case WorkerCmd_GangWrite:
+            worker_gang_write(app);
+            break;
+        case WorkerCmd_Verify:
+            worker_verify(app);
+            break;
+        case WorkerCmd_Erase:
+            worker_erase(app);
+            break;
+        case WorkerCmd_Commit:
+            worker_commit(app);
+            break;
+        case WorkerCmd_Probe:
+            worker_probe(app);
+            break;
+        case WorkerCmd_Scan:
+            worker_scan(app);
+            break;
+        case WorkerCmd_Dump:
+            worker_dump(app);
+            break;
+        default:
+            break;
+        }
+
+        worker_notify(app);
+    }
+
+    return 0;
+}
+
+// Fetch viewer pages that are not cached yet - a running fetch picks up the new position
+static void viewer_fetch(EEPROMApp* app) {
+    if(app->fetching || worker_busy(app)) return;
+
+    uint32_t base;
+    if(!viewer_next_missing(app, &base)) return;
+
+    app->fetching = true;
+    worker_send(app, WorkerCmd_Fetch);
+}
+
+// Move the viewer to the row holding address, clamped to the chip
+static void viewer_goto(EEPROMApp* app, uint32_t address) {
+    if(address >= app->memory_size) address = app->memory_size - 1;
+    address -= address % READ_VIEW_ROW_BYTES;
+
+    app->view_direction = (address < app->current_address) ? -1 : 1;
+    app->current_address = address;
+    viewer_fetch(app);
+}
+
+// Scroll by step bytes, stopping at either end
+static void viewer_scroll(EEPROMApp* app, bool down, uint32_t step) {
+    uint32_t address = app->current_address;
+    if(down) {
+        address = (step < app->memory_size - address) ? address + step : app->memory_size - 1;
+    } else {
+        address = (address > step) ? address - step : 0;
+    }
+
+    viewer_goto(app, address);
+}
+
+static bool viewer_block_used(EEPROMApp* app, uint32_t block) {
+    return app->block_summary[block / 8] & (1 << (block % 8));
+}
+
+// Start of the next data block after the region the viewer is in, wrapping
+// around once; false if the chip is blank
+static bool viewer_next_data(EEPROMApp* app, uint32_t* address) {
+    uint32_t blocks = (app->memory_size + EEPROM_OP_SUMMARY_BLOCK - 1) / EEPROM_OP_SUMMARY_BLOCK;
+    uint32_t block = app->current_address / EEPROM_OP_SUMMARY_BLOCK;
+
+    // Leave the data region the viewer is in first
+    uint32_t skipped = 0;
+    while(skipped < blocks && viewer_block_used(app, block)) {
+        block = (block + 1) % blocks;
+        skipped++;
+    }
+    for(; skipped < blocks * 2; skipped++) {
+        if(viewer_block_used(app, block)) {
+            *address = block * EEPROM_OP_SUMMARY_BLOCK;
+            return true;
+        }
+        block = (block + 1) % blocks;
+    }
+    return false;
+}
+
+// Jump to the next non-0xFF region, mapping the chip first if needed
+static void viewer_jump_data(EEPROMApp* app) {
+    if(!app->summary_valid) {
+        if(worker_busy(app)) return;
+
+        app->summarizing = true;
+        app->show_progress = true;
+        app->progress_value = 0;
+        worker_send(app, WorkerCmd_Summary);
+        return;
+    }
+
+    uint32_t address;
+    if(viewer_next_data(app, &address)) {
+        viewer_goto(app, address);
+    } else {
+        show_message(app, "Chip is blank", true);
+    }
+}
+
+// Search the chip for the next (previous) match, continuing from a match on screen
+static void viewer_find(EEPROMApp* app, bool backward) {
+    if(worker_busy(app)) return;
+
+    EEPROMPattern* pattern = &app->find_pattern;
+    if(pattern->length == 0) {
+        // Nothing to look for yet, start with a single 00 byte
+        pattern->length = 1;
+        pattern->bytes[0] = 0;
+        pattern->wild[0] = false;
+        app->find_cursor = 0;
+        app->find_editing = true;
+        return;
+    }
+    eeprom_pattern_compile(pattern);
+
+    bool shown = app->find_found && app->find_match >= app->current_address &&
+                 app->find_match < app->current_address + READ_VIEW_BYTES;
+    uint32_t anchor = shown ? app->find_match : app->current_address;
+    app->find_from = (shown && !backward) ? anchor + 1 : anchor;
+    app->find_backward = backward;
+
+    app->searching = true;
+    app->show_progress = true;
+    app->progress_value = 0;
+    worker_send(app, WorkerCmd_Search);
+}
+
+// Commit pending editor changes
+static bool commit_edits(EEPROMApp* app) {
+    if(worker_busy(app)) return false;
+
+    if(app->edits.count == 0) {
+        show_message(app, "No changes", false);
+        return false;
+    }
+    app->committing = true;
+    worker_send(app, WorkerCmd_Commit);
+    return true;
+}
+
+// Move the editor cursor by hex digits, scrolling the viewer window along
+static void editor_move(EEPROMApp* app, int32_t nibbles) {
+    int32_t position = app->edit_address * 2 + app->edit_nibble + nibbles;
+    int32_t last = app->memory_size * 2 - 1;
+    if(position < 0) position = 0;
+    if(position > last) position = last;
+    app->edit_address = position / 2;
+    app->edit_nibble = position % 2;
+
+    if(app->edit_address < app->current_address) {
+        viewer_goto(app, app->edit_address);
+    } else if(app->edit_address >= app->current_address + READ_VIEW_BYTES) {
+        viewer_goto(app, app->edit_address - (READ_VIEW_BYTES - READ_VIEW_ROW_BYTES));
+    } else {
+        viewer_fetch(app);
+    }
+}
+
+// Write file data - start async write with verification
+static bool write_file_data(EEPROMApp* app) {
+    if(worker_busy(app)) return false;
+
+    uint32_t length = range_load_length(app);
+    if(length == 0) {
+        show_message(app, "Offset past end of file!", false);
+        return false;
+    }
+
+    app->writing = true;
+    app->op_start = app->range_start;
+    app->op_file_offset = app->range_file_offset;
+    app->write_total_bytes_async = length;
+    memset(&app->write_stats, 0, sizeof(app->write_stats));
+    app->show_progress = true;
+    app->progress_value = 0;
+    app->verifying = false;
+    app->verify_only = false;
+    app->message_text[0] = '\0';
+    app->show_message = false;
+    app->gang.count = 0;
+    worker_send(app, app->gang_mode ? WorkerCmd_GangWrite : WorkerCmd_Write);
+
+    return true;
+}
+
+// Compare chip with file - start async verify without writing
+static bool verify_file_data(EEPROMApp* app) {
+    if(worker_busy(app)) return false;
+
+    uint32_t length = range_load_length(app);
+    if(length == 0) {
+        show_message(app, "Offset past end of file!", false);
+        return false;
+    }
+
+    app->verifying = true;
+    app->verify_only = true;
+    app->op_start = app->range_start;
+    app->op_file_offset = app->range_file_offset;
+    app->verify_total_bytes = length;
+    memset(&app->verify_stats, 0, sizeof(app->verify_stats));
+    app->show_progress = true;
+    app->progress_value = 0;
+    app->message_text[0] = '\0';
+    app->show_message = false;
+    app->gang.count = 0;
+    worker_send(app, WorkerCmd_Verify);
+
+    return true;
+}
+
+// Erase memory range - start async erase operation
+static bool erase_memory_range(EEPROMApp* app, uint32_t start_addr, uint32_t length) {
+    if(worker_busy(app)) return false;
+
+    // Start async erase
+    app->erasing = true;
+    app->op_start = start_addr;
+    app->op_length = length;
+    app->erase_pages_erased = 0;
+    app->erase_pages_skipped = 0;
+    app->show_progress = true;
+    app->progress_value = 0;
+    worker_send(app, WorkerCmd_Erase);
+
+    return true;
+}
+
+// Scan I2C bus for devices - start async scan
+static void scan_i2c_bus(EEPROMApp* app) {
+    if(worker_busy(app)) return;
+
+    app->scanning_i2c = true;
+    worker_send(app, WorkerCmd_Scan);
+}
+
+// Save memory to file - start async dump
+static bool save_memory_to_file(EEPROMApp* app) {
+    if(worker_busy(app)) return false;
+
+    app->dumping = true;
+    app->op_start = app->range_start;
+    app->op_length = range_length(app);
+    app->show_progress = true;
+    app->progress_value = 0;
+    worker_send(app, WorkerCmd_Dump);
+
+    return true;
 }
 
 // Load file from SD card
@@ -1884,19 +3343,19 @@ static bool load_file_from_sd(EEPROMApp* app) {
     bool success = storage_file_open(file, app->file_path, FSAM_READ, FSOM_OPEN_EXISTING);
 
     if(success) {
+        // Files past 4 GB cannot be addressed by a file offset anyway
         uint64_t size = storage_file_size(file);
-        if(size > app->memory_size) {
-            size = app->memory_size; // Limit to EEPROM size
-        }
+        if(size > UINT32_MAX) size = UINT32_MAX;
 
+        // Data is streamed by the worker during restore - only check it here
         app->file_size = (uint32_t)size;
-        success = (storage_file_read(file, app->file_data, app->file_size) == app->file_size);
+        success = (app->file_size > 0);
 
         if(success) {
             app->file_loaded = true;
             // Don't show message here - will show confirmation dialog instead
         } else {
-            show_message(app, "Read error!", false);
+            show_message(app, "File is empty!", false);
         }
     } else {
         show_message(app, "File not found!", false);
@@ -1928,6 +3387,14 @@ static void scan_directory(EEPROMApp* app, const char* path) {
                 continue;
             }
 
+            // Checksums of dumps are handled along with their dump
+            size_t name_length = strlen(filename);
+            size_t suffix_length = strlen(EEPROM_CRC32_SUFFIX);
+            if(name_length > suffix_length &&
+               strcmp(filename + name_length - suffix_length, EEPROM_CRC32_SUFFIX) == 0) {
+                continue;
+            }
+
             if(is_valid_extension(filename)) {
                 add_directory_entry(app, path, filename, false);
             }
@@ -1995,6 +3462,9 @@ static EEPROMApp* eeprom_app_alloc() {
     furi_assert(app);
 
     app->mutex = furi_mutex_alloc(FuriMutexTypeNormal);
+    app->event_queue = furi_message_queue_alloc(16, sizeof(AppEvent));
+    app->redraw_timer =
+        furi_timer_alloc(eeprom_redraw_timer_callback, FuriTimerTypePeriodic, app);
     app->gui = static_cast<Gui*>(furi_record_open(RECORD_GUI));
     app->view_port = view_port_alloc();
 
@@ -2005,16 +3475,30 @@ static EEPROMApp* eeprom_app_alloc() {
     // Initialize EEPROM
     app->i2c_address = EEPROM_24C02_BASE_ADDR;
     app->chip_type = EEPROMType_24C02; // Default to 24C02
-    app->eeprom = new EEPROM24C02(app->i2c_address);
-    app->eeprom_connected = app->eeprom->isAvailable();
-
-    // Initialize buffers (NULL first, will be allocated by reallocate_buffers)
-    app->memory_data = nullptr;
-    app->file_data = nullptr;
-    app->verify_buffer = nullptr;
-
-    // Allocate buffers for default chip type
-    reallocate_buffers(app);
+    app->transport = new EEPROMHalTransport();
+    app->bus_speed = BusSpeed_400k;
+    app->transport->setClock(bus_speed_clock[app->bus_speed]);
+    app->eeprom = new EEPROM24C02(app->transport, app->i2c_address);
+    app->geometry = get_eeprom_geometry(app->chip_type);
+    app->chip_detected = false;
+    app->probing = false;
+    // Probe (with detection) is queued once the worker runs
+    app->eeprom_connected = false;
+
+    // Empty viewer cache for default chip type
+    apply_geometry(app);
+    app->view_direction = 1;
+    app->fetching = false;
+    app->view_jump = READ_VIEW_BYTES;
+    app->goto_editing = false;
+    app->goto_address = 0;
+    app->goto_cursor = 0;
+    app->summarizing = false;
+    app->find_pattern.length = 0;
+    app->find_editing = false;
+    app->find_cursor = 0;
+    app->searching = false;
+    app->find_found = false;
 
     // Initialize state
     app->running = true;
@@ -2035,32 +3519,31 @@ static EEPROMApp* eeprom_app_alloc() {
 
     // Initialize async erase
     app->erasing = false;
-    app->erase_current_addr = 0;
-    app->erase_last_update = 0;
-
-    // Initialize async read
-    app->reading = false;
-    app->read_current_addr = 0;
-    app->read_last_update = 0;
-    app->read_total_bytes = 0;
-    app->read_completed = false;
+    app->erase_pages_erased = 0;
+    app->erase_pages_skipped = 0;
 
     // Initialize async write
     app->writing = false;
-    app->write_current_addr_async = 0;
-    app->write_last_update = 0;
     app->write_total_bytes_async = 0;
+    app->smart_write = true;
+    app->gang_mode = false;
+    app->gang.count = 0;
+    memset(&app->write_stats, 0, sizeof(app->write_stats));
 
     // Initialize async verify
     app->verifying = false;
-    app->verify_current_addr = 0;
-    app->verify_last_update = 0;
+    app->verify_only = false;
     app->verify_total_bytes = 0;
+    memset(&app->verify_stats, 0, sizeof(app->verify_stats));
 
     // Initialize file operations
     app->file_path[0] = '\0';
     app->file_loaded = false;
     app->file_size = 0;
+    app->range_file_offset = 0;
+    app->op_start = 0;
+    app->op_length = 0;
+    app->op_file_offset = 0;
 
     // Initialize confirmation dialog
     app->confirm_load_yes = false;
@@ -2068,6 +3551,7 @@ static EEPROMApp* eeprom_app_alloc() {
 
     // Initialize save operations
     app->save_mode = false;
+    app->dumping = false;
     app->save_path[0] = '\0';
 
     // Initialize file browser
@@ -2083,15 +3567,10 @@ static EEPROMApp* eeprom_app_alloc() {
         app->file_list[i] = nullptr;
     }
 
-    // Initialize write data
-    app->write_start_addr = 0;
-    app->write_length = 4;
-    app->write_cursor = 0;
-    for(uint8_t i = 0; i < 16; i++) {
-        app->write_data[i] = 0x00;
-    }
-
-    // Memory data is initialized by reallocate_buffers()
+    // Initialize editor, edits themselves are reset with the geometry
+    app->edit_address = 0;
+    app->edit_nibble = 0;
+    app->committing = false;
 
     // Initialize I2C Scanner
     app->i2c_device_count = 0;
@@ -2100,6 +3579,20 @@ static EEPROMApp* eeprom_app_alloc() {
         app->i2c_devices[i] = false;
     }
 
+    // Start EEPROM worker thread
+    app->worker_cancel = false;
+    app->worker_event_pending = false;
+    app->worker_queue = furi_message_queue_alloc(8, sizeof(EEPROMWorkerCommand));
+    app->worker_thread =
+        furi_thread_alloc_ex("EEPROMWorker", 2 * 1024, eeprom_worker_thread, app);
+    furi_thread_start(app->worker_thread);
+
+    // Identify the chip on connect
+    furi_mutex_acquire(app->mutex, FuriWaitForever);
+    app->probing = true;
+    furi_mutex_release(app->mutex);
+    worker_send(app, WorkerCmd_Probe);
+
     return app;
 }
 
@@ -2107,20 +3600,29 @@ static EEPROMApp* eeprom_app_alloc() {
 static void eeprom_app_free(EEPROMApp* app) {
     furi_assert(app);
 
+    // Stop worker before releasing anything it uses
+    app->worker_cancel = true;
+    EEPROMWorkerCommand stop_command = {};
+    stop_command.type = WorkerCmd_Stop;
+    furi_message_queue_put(app->worker_queue, &stop_command, FuriWaitForever);
+    furi_thread_join(app->worker_thread);
+    furi_thread_free(app->worker_thread);
+    furi_message_queue_free(app->worker_queue);
+
+    furi_timer_stop(app->redraw_timer);
+    furi_timer_free(app->redraw_timer);
+
     gui_remove_view_port(app->gui, app->view_port);
     view_port_free(app->view_port);
     furi_record_close(RECORD_GUI);
+    furi_message_queue_free(app->event_queue);
     furi_mutex_free(app->mutex);
 
     // Free file list
     free_file_list(app);
 
-    // Free dynamically allocated buffers
-    if(app->memory_data) free(app->memory_data);
-    if(app->file_data) free(app->file_data);
-    if(app->verify_buffer) free(app->verify_buffer);
-
     delete app->eeprom;
+    delete app->transport;
     free(app);
 }
 
@@ -2144,9 +3646,26 @@ extern "C" int32_t eeprom_app_24cxx(void* p) {
     // Restore main draw callback
     view_port_draw_callback_set(app->view_port, eeprom_draw_callback, app);
 
+    view_port_update(app->view_port);
+
+    // Sleep until input, worker state change or animation tick
+    AppEvent event;
     while(app->running) {
+        if(furi_message_queue_get(app->event_queue, &event, FuriWaitForever) != FuriStatusOk) {
+            continue;
+        }
+
+        if(event.type == AppEventType_Input) {
+            eeprom_process_input(app, &event.input);
+        } else if(event.type == AppEventType_Worker) {
+            app->worker_event_pending = false;
+        }
+
+        furi_mutex_acquire(app->mutex, FuriWaitForever);
+        update_redraw_timer(app);
+        furi_mutex_release(app->mutex);
+
         view_port_update(app->view_port);
-        furi_delay_ms(100);
     }
 
     eeprom_app_free(app);
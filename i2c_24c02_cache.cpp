@@ -0,0 +1,86 @@
+#include "i2c_24c02_cache.hpp"
+#include <string.h>
+
+static_assert(
+    (EEPROM_CACHE_PAGE_SIZE & (EEPROM_CACHE_PAGE_SIZE - 1)) == 0 && EEPROM_CACHE_PAGE_SIZE <= 128,
+    "cache page must divide the smallest chip");
+
+static uint32_t cache_page_base(uint32_t address) {
+    return address & ~(uint32_t)(EEPROM_CACHE_PAGE_SIZE - 1);
+}
+
+// Slot holding the page at base, stale or not; -1 if none
+static int cache_slot(const EEPROMPageCache* cache, uint32_t base) {
+    for(int i = 0; i < EEPROM_CACHE_PAGES; i++) {
+        if(cache->pages[i].used != 0 && cache->pages[i].base == base) return i;
+    }
+    return -1;
+}
+
+void eeprom_cache_reset(EEPROMPageCache* cache, uint32_t size) {
+    memset(cache->pages, 0, sizeof(cache->pages));
+    cache->clock = 0;
+    cache->size = size;
+}
+
+const uint8_t* eeprom_cache_lookup(EEPROMPageCache* cache, uint32_t address, bool* fresh) {
+    if(address >= cache->size) return nullptr;
+
+    int slot = cache_slot(cache, cache_page_base(address));
+    if(slot < 0) return nullptr;
+
+    EEPROMCachePage* page = &cache->pages[slot];
+    page->used = ++cache->clock;
+    if(fresh) *fresh = !page->stale;
+    return page->data;
+}
+
+bool eeprom_cache_next_missing(
+    const EEPROMPageCache* cache,
+    uint32_t start,
+    uint32_t length,
+    uint32_t* base) {
+    if(start >= cache->size) return false;
+    if(length > cache->size - start) length = cache->size - start;
+
+    uint32_t end = start + length;
+    for(uint32_t page_base = cache_page_base(start); page_base < end;
+        page_base += EEPROM_CACHE_PAGE_SIZE) {
+        int slot = cache_slot(cache, page_base);
+        if(slot < 0 || cache->pages[slot].stale) {
+            *base = page_base;
+            return true;
+        }
+    }
+    return false;
+}
+
+void eeprom_cache_store(EEPROMPageCache* cache, uint32_t base, const uint8_t* data) {
+    int slot = cache_slot(cache, base);
+    if(slot < 0) {
+        // Empty slots have the lowest stamp and go first
+        slot = 0;
+        for(int i = 1; i < EEPROM_CACHE_PAGES; i++) {
+            if(cache->pages[i].used < cache->pages[slot].used) slot = i;
+        }
+    }
+
+    EEPROMCachePage* page = &cache->pages[slot];
+    page->base = base;
+    page->used = ++cache->clock;
+    page->stale = false;
+    memcpy(page->data, data, EEPROM_CACHE_PAGE_SIZE);
+}
+
+void eeprom_cache_invalidate(EEPROMPageCache* cache, uint32_t start, uint32_t length) {
+    if(length == 0) return;
+
+    uint32_t first = cache_page_base(start);
+    uint32_t last = cache_page_base(start + length - 1);
+    for(int i = 0; i < EEPROM_CACHE_PAGES; i++) {
+        EEPROMCachePage* page = &cache->pages[i];
+        if(page->used != 0 && page->base >= first && page->base <= last) {
+            page->stale = true;
+        }
+    }
+}
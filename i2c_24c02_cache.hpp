@@ -0,0 +1,44 @@
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+
+// Small LRU cache of EEPROM contents for browsing without reading the whole chip
+// Platform-free: the owner reads pages from the chip and stores them here
+
+#define EEPROM_CACHE_PAGE_SIZE 32 // Bytes per cache page, power of two dividing every chip size
+#define EEPROM_CACHE_PAGES     16 // Resident pages, 512 bytes of data
+#define EEPROM_CACHE_PREFETCH  4 // Pages fetched ahead in the scroll direction
+
+typedef struct {
+    uint32_t base; // Address of the first byte
+    uint32_t used; // LRU stamp, 0 while the slot is empty
+    bool stale; // Chip was written since the page was read
+    uint8_t data[EEPROM_CACHE_PAGE_SIZE];
+} EEPROMCachePage;
+
+typedef struct {
+    EEPROMCachePage pages[EEPROM_CACHE_PAGES];
+    uint32_t clock; // Source of LRU stamps
+    uint32_t size; // Chip size, nothing past it is cached
+} EEPROMPageCache;
+
+// Drop every page, size is the chip capacity
+void eeprom_cache_reset(EEPROMPageCache* cache, uint32_t size);
+
+// Page data holding address or nullptr on a miss; stale pages are still
+// returned (with fresh false) so they can be shown until read again
+const uint8_t* eeprom_cache_lookup(EEPROMPageCache* cache, uint32_t address, bool* fresh);
+
+// Base of the first page overlapping the range that is missing or stale
+bool eeprom_cache_next_missing(
+    const EEPROMPageCache* cache,
+    uint32_t start,
+    uint32_t length,
+    uint32_t* base);
+
+// Keep a page read from the chip, replacing its stale copy or the least recently used page
+void eeprom_cache_store(EEPROMPageCache* cache, uint32_t base, const uint8_t* data);
+
+// Mark pages overlapping a written range stale
+void eeprom_cache_invalidate(EEPROMPageCache* cache, uint32_t start, uint32_t length);
@@ -0,0 +1,75 @@
+#pragma once
+
+#include <stdint.h>
+
+// Geometry of a 24Cxx part
+typedef struct {
+    uint32_t size; // Capacity in bytes
+    uint16_t page_size; // Native page write size in bytes
+    uint8_t address_bytes; // Word address width (1 or 2)
+    uint8_t block_bits; // Upper address bits carried in device address (24C04/08/16)
+    uint8_t write_cycle_ms; // Max internal write cycle time (tWR)
+} EEPROMGeometry;
+
+// EEPROM chip types with different sizes
+typedef enum {
+    EEPROMType_24C01, // 128 bytes (1Kb)
+    EEPROMType_24C02, // 256 bytes (2Kb)
+    EEPROMType_24C04, // 512 bytes (4Kb)
+    EEPROMType_24C08, // 1024 bytes (8Kb)
+    EEPROMType_24C16, // 2048 bytes (16Kb)
+    EEPROMType_24C32, // 4096 bytes (32Kb)
+    EEPROMType_24C64, // 8192 bytes (64Kb)
+    EEPROMType_24C128, // 16384 bytes (128Kb)
+    EEPROMType_24C256, // 32768 bytes (256Kb)
+    EEPROMType_24C512, // 65536 bytes (512Kb)
+    EEPROMType_Count
+} EEPROMType;
+
+// Everything that differs between chip types
+typedef struct {
+    const char* name; // Part name, also used in dump file names
+    EEPROMGeometry geometry;
+    uint8_t address_digits; // Hex digits needed to show any address
+} EEPROMChipTraits;
+
+// Traits of each supported chip, indexed by EEPROMType
+static constexpr EEPROMChipTraits eeprom_chip_traits[EEPROMType_Count] = {
+    // name, {size, page size, address bytes, block bits, max tWR (ms)}, address digits
+    {"24C01", {128, 8, 1, 0, 5}, 2},
+    {"24C02", {256, 8, 1, 0, 5}, 2},
+    {"24C04", {512, 16, 1, 1, 5}, 3},
+    {"24C08", {1024, 16, 1, 2, 5}, 3},
+    {"24C16", {2048, 16, 1, 3, 5}, 3},
+    {"24C32", {4096, 32, 2, 0, 10}, 3},
+    {"24C64", {8192, 32, 2, 0, 10}, 4},
+    {"24C128", {16384, 64, 2, 0, 5}, 4},
+    {"24C256", {32768, 64, 2, 0, 5}, 4},
+    {"24C512", {65536, 128, 2, 0, 5}, 4},
+};
+
+// Table sanity, checked at compile time
+static constexpr bool eeprom_chip_traits_valid(int type) {
+    return type == EEPROMType_Count ||
+           (eeprom_chip_traits[type].geometry.size == (128UL << type) &&
+            (eeprom_chip_traits[type].geometry.page_size &
+             (eeprom_chip_traits[type].geometry.page_size - 1)) == 0 &&
+            (eeprom_chip_traits[type].geometry.address_bytes == 2 ||
+             eeprom_chip_traits[type].geometry.size <=
+                 (256UL << eeprom_chip_traits[type].geometry.block_bits)) &&
+            (1UL << (4 * eeprom_chip_traits[type].address_digits)) >=
+                eeprom_chip_traits[type].geometry.size &&
+            eeprom_chip_traits_valid(type + 1));
+}
+static_assert(eeprom_chip_traits_valid(0), "eeprom_chip_traits out of order or inconsistent");
+
+// Helper function to get chip traits
+static inline const EEPROMChipTraits& get_eeprom_traits(EEPROMType type) {
+    if(type >= EEPROMType_Count) type = EEPROMType_24C02;
+    return eeprom_chip_traits[type];
+}
+
+// Helper function to get EEPROM geometry
+static inline const EEPROMGeometry& get_eeprom_geometry(EEPROMType type) {
+    return get_eeprom_traits(type).geometry;
+}
@@ -0,0 +1,50 @@
+#include "i2c_24c02_crc.hpp"
+#include <stdio.h>
+#include <stdlib.h>
+
+// 256-entry lookup table built at compile time, lives in flash
+struct CRC32Table {
+    uint32_t entries[256];
+
+    constexpr CRC32Table()
+        : entries() {
+        for(uint32_t i = 0; i < 256; i++) {
+            uint32_t crc = i;
+            for(uint8_t bit = 0; bit < 8; bit++) {
+                crc = (crc & 1) ? (crc >> 1) ^ 0xEDB88320UL : crc >> 1;
+            }
+            entries[i] = crc;
+        }
+    }
+};
+
+static constexpr CRC32Table crc32_table;
+
+static_assert(crc32_table.entries[1] == 0x77073096UL, "CRC32 table generation");
+
+uint32_t eeprom_crc32(uint32_t crc, const uint8_t* data, uint32_t length) {
+    crc = ~crc;
+    for(uint32_t i = 0; i < length; i++) {
+        crc = crc32_table.entries[(crc ^ data[i]) & 0xFF] ^ (crc >> 8);
+    }
+    return ~crc;
+}
+
+size_t eeprom_crc32_record_format(char* buffer, size_t size, uint32_t crc, uint32_t length) {
+    int written =
+        snprintf(buffer, size, "%08lX %lu\n", (unsigned long)crc, (unsigned long)length);
+    return (written > 0 && (size_t)written < size) ? (size_t)written : 0;
+}
+
+bool eeprom_crc32_record_parse(const char* text, uint32_t* crc, uint32_t* length) {
+    char* end;
+    unsigned long value = strtoul(text, &end, 16);
+    if(end != text + 8 || *end != ' ') return false;
+    *crc = (uint32_t)value;
+
+    text = end + 1;
+    value = strtoul(text, &end, 10);
+    if(end == text) return false;
+    *length = (uint32_t)value;
+    return true;
+}
@@ -0,0 +1,21 @@
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+// CRC-32 (IEEE 802.3, reflected 0xEDB88320), same values as zlib crc32() and `crc32` tools
+// Incremental: start with EEPROM_CRC32_INIT and feed each chunk with the previous result
+#define EEPROM_CRC32_INIT 0
+
+// Dumps keep their checksum in <dump>.crc32: "<crc hex> <length>\n"
+#define EEPROM_CRC32_SUFFIX      ".crc32"
+#define EEPROM_CRC32_RECORD_SIZE 24 // Longest record plus terminator
+
+uint32_t eeprom_crc32(uint32_t crc, const uint8_t* data, uint32_t length);
+
+// Text of a checksum file, returns its length
+size_t eeprom_crc32_record_format(char* buffer, size_t size, uint32_t crc, uint32_t length);
+
+// Parse a checksum file, false if malformed
+bool eeprom_crc32_record_parse(const char* text, uint32_t* crc, uint32_t* length);
@@ -0,0 +1,101 @@
+#include "i2c_24c02_edit.hpp"
+#include <string.h>
+
+static bool edit_page_dirty(const EEPROMEditBuffer* edits, uint32_t page) {
+    return edits->dirty[page / 8] & (1 << (page % 8));
+}
+
+bool eeprom_edit_reset(EEPROMEditBuffer* edits, uint32_t size, uint16_t page_size) {
+    // Measured page sizes can be smaller than the table's, giving more pages than bits
+    bool fits = page_size > 0 && size / page_size <= EEPROM_EDIT_MAX_PAGES;
+    edits->count = 0;
+    edits->size = fits ? size : 0;
+    edits->page_size = fits ? page_size : 1;
+    memset(edits->dirty, 0, sizeof(edits->dirty));
+    return fits;
+}
+
+bool eeprom_edit_get(const EEPROMEditBuffer* edits, uint32_t address, uint8_t* value) {
+    // Clean pages hold no edits, most lookups stop here
+    if(address >= edits->size || !edit_page_dirty(edits, address / edits->page_size)) {
+        return false;
+    }
+
+    for(uint16_t i = 0; i < edits->count; i++) {
+        if(edits->bytes[i].address == address) {
+            *value = edits->bytes[i].value;
+            return true;
+        }
+    }
+    return false;
+}
+
+bool eeprom_edit_set(EEPROMEditBuffer* edits, uint32_t address, uint8_t value) {
+    if(address >= edits->size) return false;
+
+    uint32_t page = address / edits->page_size;
+    if(page >= EEPROM_EDIT_MAX_PAGES) return false;
+    if(edit_page_dirty(edits, page)) {
+        for(uint16_t i = 0; i < edits->count; i++) {
+            if(edits->bytes[i].address == address) {
+                edits->bytes[i].value = value;
+                return true;
+            }
+        }
+    }
+    if(edits->count == EEPROM_EDIT_MAX) return false;
+
+    edits->bytes[edits->count].address = address;
+    edits->bytes[edits->count].value = value;
+    edits->count++;
+    edits->dirty[page / 8] |= 1 << (page % 8);
+    return true;
+}
+
+uint32_t eeprom_edit_dirty_pages(const EEPROMEditBuffer* edits) {
+    uint32_t pages = 0;
+    for(size_t i = 0; i < sizeof(edits->dirty); i++) {
+        for(uint8_t bits = edits->dirty[i]; bits; bits &= bits - 1) {
+            pages++;
+        }
+    }
+    return pages;
+}
+
+bool eeprom_edit_next_dirty(const EEPROMEditBuffer* edits, uint32_t page, uint32_t* dirty) {
+    uint32_t pages = edits->size / edits->page_size;
+    for(; page < pages; page++) {
+        if(edit_page_dirty(edits, page)) {
+            *dirty = page;
+            return true;
+        }
+    }
+    return false;
+}
+
+uint32_t
+    eeprom_edit_apply(const EEPROMEditBuffer* edits, uint32_t start, uint8_t* data, uint32_t length) {
+    uint32_t applied = 0;
+    for(uint16_t i = 0; i < edits->count; i++) {
+        uint32_t address = edits->bytes[i].address;
+        if(address >= start && address - start < length) {
+            data[address - start] = edits->bytes[i].value;
+            applied++;
+        }
+    }
+    return applied;
+}
+
+void eeprom_edit_drop_page(EEPROMEditBuffer* edits, uint32_t page) {
+    if(page >= EEPROM_EDIT_MAX_PAGES) return;
+
+    // Compact in place, keeping the order of the remaining edits
+    uint16_t kept = 0;
+    for(uint16_t i = 0; i < edits->count; i++) {
+        if(edits->bytes[i].address / edits->page_size != page) {
+            edits->bytes[kept++] = edits->bytes[i];
+        }
+    }
+    edits->count = kept;
+    edits->dirty[page / 8] &= ~(1 << (page % 8));
+}
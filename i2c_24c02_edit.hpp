@@ -0,0 +1,46 @@
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+
+// Pending byte edits waiting to be committed page by page
+// Platform-free: the owner shows them over chip data and hands them to eeprom_op_commit()
+
+#define EEPROM_EDIT_MAX       128 // Edited bytes held until commit
+#define EEPROM_EDIT_MAX_PAGES 1024 // 24C512 even if detection finds 64-byte pages
+
+typedef struct {
+    uint16_t address; // Chips are at most 64 KB
+    uint8_t value;
+} EEPROMEditByte;
+
+typedef struct {
+    EEPROMEditByte bytes[EEPROM_EDIT_MAX];
+    uint16_t count;
+    uint32_t size; // Chip size, 0 when its pages do not fit the dirty bitmap
+    uint16_t page_size; // Native page size, the unit of a commit
+    uint8_t dirty[EEPROM_EDIT_MAX_PAGES / 8]; // Bit per native page holding edits
+} EEPROMEditBuffer;
+
+// Drop every edit; false when size / page_size exceeds EEPROM_EDIT_MAX_PAGES, the buffer
+// then takes no edits
+bool eeprom_edit_reset(EEPROMEditBuffer* edits, uint32_t size, uint16_t page_size);
+
+// Pending value of address, false if it was not edited
+bool eeprom_edit_get(const EEPROMEditBuffer* edits, uint32_t address, uint8_t* value);
+
+// Set or replace the pending value of address, false when the buffer is full
+bool eeprom_edit_set(EEPROMEditBuffer* edits, uint32_t address, uint8_t value);
+
+// Number of native pages holding edits
+uint32_t eeprom_edit_dirty_pages(const EEPROMEditBuffer* edits);
+
+// First page index at or after page that holds edits
+bool eeprom_edit_next_dirty(const EEPROMEditBuffer* edits, uint32_t page, uint32_t* dirty);
+
+// Copy edits inside [start, start + length) over data, returns how many bytes were edited
+uint32_t
+    eeprom_edit_apply(const EEPROMEditBuffer* edits, uint32_t start, uint8_t* data, uint32_t length);
+
+// Forget the edits of a page once it is on the chip
+void eeprom_edit_drop_page(EEPROMEditBuffer* edits, uint32_t page);
@@ -0,0 +1,107 @@
+#include "i2c_24c02_hal.hpp"
+#include "furi_hal_i2c.h"
+#include <furi.h>
+#include <stm32wbxx_ll_i2c.h>
+#include <stm32wbxx_ll_system.h>
+
+// TIMINGR values for I2CCLK = 64 MHz (STM32CubeMX, rise/fall time 0 ns)
+#define HAL_I2C_TIMINGS_100  0x10707DBC
+#define HAL_I2C_TIMINGS_400  0x00602173
+#define HAL_I2C_TIMINGS_1000 0x00300B29
+
+// Clock applied each time the handle is activated
+static uint32_t hal_clock_hz = EEPROM_BUS_CLOCK_STANDARD;
+
+static uint32_t halTimings(uint32_t clock_hz) {
+    if(clock_hz >= EEPROM_BUS_CLOCK_FAST_PLUS) return HAL_I2C_TIMINGS_1000;
+    if(clock_hz >= EEPROM_BUS_CLOCK_FAST) return HAL_I2C_TIMINGS_400;
+    return HAL_I2C_TIMINGS_100;
+}
+
+// Stock external handle setup (pins, 100 kHz), then our timing on top
+static void halHandleEvent(const FuriHalI2cBusHandle* handle, FuriHalI2cBusHandleEvent event) {
+    furi_hal_i2c_bus_handle_external_event(handle, event);
+
+    if(event == FuriHalI2cBusHandleEventActivate) {
+        // Timing register is only writable with the peripheral disabled
+        LL_I2C_Disable(handle->bus->i2c);
+        if(hal_clock_hz >= EEPROM_BUS_CLOCK_FAST_PLUS) {
+            LL_SYSCFG_EnableFastModePlus(LL_SYSCFG_I2C_FASTMODEPLUS_I2C3);
+        }
+        LL_I2C_SetTiming(handle->bus->i2c, halTimings(hal_clock_hz));
+        LL_I2C_Enable(handle->bus->i2c);
+    } else if(event == FuriHalI2cBusHandleEventDeactivate) {
+        LL_SYSCFG_DisableFastModePlus(LL_SYSCFG_I2C_FASTMODEPLUS_I2C3);
+    }
+}
+
+// External bus (C0/C1) with selectable clock
+static const FuriHalI2cBusHandle hal_i2c_handle = {&furi_hal_i2c_bus_external, halHandleEvent};
+
+static FuriHalI2cBegin halBegin(EEPROMBusBegin begin) {
+    return (begin == EEPROMBusBeginRestart) ? FuriHalI2cBeginRestart : FuriHalI2cBeginStart;
+}
+
+static FuriHalI2cEnd halEnd(EEPROMBusEnd end) {
+    return (end == EEPROMBusEndAwaitRestart) ? FuriHalI2cEndAwaitRestart : FuriHalI2cEndStop;
+}
+
+void EEPROMHalTransport::acquire() {
+    furi_hal_i2c_acquire(&hal_i2c_handle);
+}
+
+void EEPROMHalTransport::release() {
+    furi_hal_i2c_release(&hal_i2c_handle);
+}
+
+bool EEPROMHalTransport::tx(
+    uint8_t address,
+    const uint8_t* data,
+    size_t size,
+    EEPROMBusBegin begin,
+    EEPROMBusEnd end,
+    uint32_t timeout) {
+    return furi_hal_i2c_tx_ext(
+        &hal_i2c_handle,
+        address,
+        false,
+        data,
+        size,
+        halBegin(begin),
+        halEnd(end),
+        timeout);
+}
+
+bool EEPROMHalTransport::rx(
+    uint8_t address,
+    uint8_t* data,
+    size_t size,
+    EEPROMBusBegin begin,
+    EEPROMBusEnd end,
+    uint32_t timeout) {
+    return furi_hal_i2c_rx_ext(
+        &hal_i2c_handle,
+        address,
+        false,
+        data,
+        size,
+        halBegin(begin),
+        halEnd(end),
+        timeout);
+}
+
+bool EEPROMHalTransport::isDeviceReady(uint8_t address, uint32_t timeout) {
+    return furi_hal_i2c_is_device_ready(&hal_i2c_handle, address, timeout);
+}
+
+uint32_t EEPROMHalTransport::getTick() {
+    return furi_get_tick();
+}
+
+void EEPROMHalTransport::setClock(uint32_t clock_hz) {
+    hal_clock_hz = clock_hz;
+}
+
+uint32_t EEPROMHalTransport::getClock() {
+    return hal_clock_hz;
+}
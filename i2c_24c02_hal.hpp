@@ -0,0 +1,34 @@
+#pragma once
+
+#include "i2c_24c02_transport.hpp"
+
+// EEPROM transport on the Flipper external I2C bus (pins C0/C1)
+// Uses its own bus handle so the clock can be raised above the stock 100 kHz
+class EEPROMHalTransport : public EEPROMTransport {
+public:
+    void acquire() override;
+    void release() override;
+
+    bool tx(
+        uint8_t address,
+        const uint8_t* data,
+        size_t size,
+        EEPROMBusBegin begin,
+        EEPROMBusEnd end,
+        uint32_t timeout) override;
+
+    bool rx(
+        uint8_t address,
+        uint8_t* data,
+        size_t size,
+        EEPROMBusBegin begin,
+        EEPROMBusEnd end,
+        uint32_t timeout) override;
+
+    bool isDeviceReady(uint8_t address, uint32_t timeout) override;
+
+    uint32_t getTick() override;
+
+    void setClock(uint32_t clock_hz) override;
+    uint32_t getClock() override;
+};
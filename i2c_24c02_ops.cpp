@@ -0,0 +1,788 @@
+#include "i2c_24c02_ops.hpp"
+#include <stdlib.h>
+#include <string.h>
+
+// Ring buffer staging input data between source and EEPROM
+typedef struct {
+    uint8_t data[EEPROM_OP_RING_SIZE];
+    uint32_t head; // Total bytes put
+    uint32_t tail; // Total bytes taken
+} StreamRing;
+
+static bool op_cancelled(const EEPROMOpControl* control) {
+    return control && control->cancel && *control->cancel;
+}
+
+static void op_progress(const EEPROMOpControl* control, uint32_t done, uint32_t total) {
+    if(control && control->progress) {
+        control->progress(done, total, control->context);
+    }
+}
+
+// Check if data is erased (all 0xFF)
+static bool is_blank(const uint8_t* data, uint32_t length) {
+    for(uint32_t i = 0; i < length; i++) {
+        if(data[i] != 0xFF) return false;
+    }
+    return true;
+}
+
+// Bytes from address to the end of its native page, capped at end
+static uint32_t page_chunk(uint32_t addr, uint32_t end, uint16_t page_size) {
+    uint32_t chunk_size = page_size - (addr % page_size);
+    if(addr + chunk_size > end) chunk_size = end - addr;
+    return chunk_size;
+}
+
+// Number of bytes staged in ring
+static uint32_t stream_ring_count(const StreamRing* ring) {
+    return ring->head - ring->tail;
+}
+
+// Top up ring from source; returns false on read error
+static bool stream_ring_fill(
+    StreamRing* ring,
+    EEPROMSourceCallback source,
+    void* source_context,
+    uint32_t* source_remaining) {
+    while(*source_remaining > 0 && stream_ring_count(ring) < EEPROM_OP_RING_SIZE) {
+        uint32_t offset = ring->head % EEPROM_OP_RING_SIZE;
+        uint32_t to_read = EEPROM_OP_RING_SIZE - stream_ring_count(ring);
+        if(to_read > EEPROM_OP_RING_SIZE - offset) to_read = EEPROM_OP_RING_SIZE - offset;
+        if(to_read > *source_remaining) to_read = *source_remaining;
+
+        if(!source(source_context, &ring->data[offset], to_read)) {
+            return false;
+        }
+
+        ring->head += to_read;
+        *source_remaining -= to_read;
+    }
+
+    return true;
+}
+
+// Take contiguous bytes from ring
+static void stream_ring_take(StreamRing* ring, uint8_t* buffer, uint32_t length) {
+    uint32_t offset = ring->tail % EEPROM_OP_RING_SIZE;
+    uint32_t first = EEPROM_OP_RING_SIZE - offset;
+    if(first > length) first = length;
+
+    memcpy(buffer, &ring->data[offset], first);
+    memcpy(&buffer[first], ring->data, length - first);
+    ring->tail += length;
+}
+
+EEPROMOpResult eeprom_op_erase(
+    EEPROM24C02* eeprom,
+    uint32_t start_addr,
+    uint32_t length,
+    const EEPROMOpControl* control,
+    EEPROMEraseStats* stats) {
+    uint16_t page_size = eeprom->getGeometry().page_size;
+    uint32_t end = start_addr + length;
+    uint8_t erase_data[EEPROM_MAX_PAGE_SIZE];
+    memset(erase_data, 0xFF, sizeof(erase_data));
+    uint8_t* block = static_cast<uint8_t*>(malloc(EEPROM_OP_ERASE_BLOCK));
+    stats->pages_erased = 0;
+    stats->pages_skipped = 0;
+    if(block == nullptr) return EEPROMOpNoMemory;
+
+    EEPROMBusSession session(*eeprom);
+    EEPROMTransferQueue queue(*eeprom);
+    EEPROMOpResult result = EEPROMOpOk;
+    uint32_t block_addr = start_addr;
+    while(result == EEPROMOpOk && block_addr < end) {
+        if(op_cancelled(control)) {
+            result = EEPROMOpCancelled;
+            break;
+        }
+        session.yield();
+
+        // Blocks end on a page boundary so no page is split between two reads
+        uint32_t block_end = (block_addr + EEPROM_OP_ERASE_BLOCK) / page_size * page_size;
+        if(block_end > end) block_end = end;
+
+        // One bulk read tells which pages of the block need erasing
+        if(!eeprom->readSequential(block_addr, block, block_end - block_addr)) {
+            result = EEPROMOpReadError;
+            break;
+        }
+
+        uint32_t addr = block_addr;
+        while(addr < block_end) {
+            uint32_t chunk_size = page_chunk(addr, block_end, page_size);
+
+            if(is_blank(&block[addr - block_addr], chunk_size)) {
+                stats->pages_skipped++;
+            } else if(queue.write(addr, erase_data, chunk_size)) {
+                stats->pages_erased++;
+            } else {
+                result = EEPROMOpWriteError;
+                break;
+            }
+            addr += chunk_size;
+        }
+
+        // Pages of this block go out before the next blank check
+        if(result == EEPROMOpOk && !queue.flush()) {
+            result = EEPROMOpWriteError;
+        }
+
+        block_addr = block_end;
+        op_progress(control, block_addr - start_addr, length);
+    }
+
+    free(block);
+    return result;
+}
+
+static void write_stats_reset(EEPROMWriteStats* stats) {
+    memset(stats, 0, sizeof(EEPROMWriteStats));
+}
+
+// Account the ACK polls of the write cycle that just ended
+static void write_stats_polls(EEPROM24C02* eeprom, EEPROMWriteStats* stats) {
+    uint16_t polls = eeprom->getLastPollCount();
+    stats->ack_polls += polls;
+    if(polls > stats->max_page_polls) stats->max_page_polls = polls;
+}
+
+// Finish a page once its write cycle is running: wait for the chip, then with
+// verify read the page back and rewrite it until it matches or retries run out
+static EEPROMOpResult write_finish_page(
+    EEPROM24C02* eeprom,
+    uint32_t addr,
+    const uint8_t* data,
+    uint32_t length,
+    bool verify,
+    uint8_t* readback,
+    EEPROMWriteStats* stats) {
+    if(!eeprom->waitWriteComplete()) return EEPROMOpWriteError;
+    write_stats_polls(eeprom, stats);
+    if(!verify) {
+        memcpy(readback, data, length);
+        return EEPROMOpOk;
+    }
+
+    for(uint8_t attempt = 0;; attempt++) {
+        if(!eeprom->readBytes(addr, readback, length)) return EEPROMOpReadError;
+        if(memcmp(readback, data, length) == 0) return EEPROMOpOk;
+        if(attempt == EEPROM_OP_WRITE_RETRIES) break;
+
+        stats->pages_retried++;
+        if(!eeprom->writeBytes(addr, data, length)) return EEPROMOpWriteError;
+        write_stats_polls(eeprom, stats);
+    }
+
+    // Keep going so the report covers the whole range
+    for(uint32_t i = 0; i < length; i++) {
+        if(readback[i] == data[i]) continue;
+        if(stats->bytes_failed < EEPROM_OP_FAILED_REPORT) {
+            stats->failed_addresses[stats->bytes_failed] = addr + i;
+        }
+        stats->bytes_failed++;
+    }
+    return EEPROMOpOk;
+}
+
+EEPROMOpResult eeprom_op_write(
+    EEPROM24C02* eeprom,
+    uint32_t start_addr,
+    uint32_t length,
+    EEPROMSourceCallback source,
+    void* source_context,
+    bool smart,
+    bool verify,
+    uint8_t* mirror,
+    const EEPROMOpControl* control,
+    EEPROMWriteStats* stats) {
+    uint16_t page_size = eeprom->getGeometry().page_size;
+    uint32_t end = start_addr + length;
+    StreamRing* ring = static_cast<StreamRing*>(malloc(sizeof(StreamRing)));
+    // Page being prepared and the one in its write cycle alternate, plus readback
+    uint8_t* page_buffers = static_cast<uint8_t*>(malloc(EEPROM_MAX_PAGE_SIZE * 3));
+    write_stats_reset(stats);
+    if(ring == nullptr || page_buffers == nullptr) {
+        free(page_buffers);
+        free(ring);
+        return EEPROMOpNoMemory;
+    }
+    ring->head = 0;
+    ring->tail = 0;
+
+    uint8_t* pages[2] = {page_buffers, page_buffers + EEPROM_MAX_PAGE_SIZE};
+    uint8_t* current = page_buffers + EEPROM_MAX_PAGE_SIZE * 2;
+    uint8_t slot = 0;
+    EEPROMBusSession session(*eeprom);
+    EEPROMOpResult result = EEPROMOpOk;
+    uint32_t source_remaining = length;
+    bool write_pending = false; // Chip is busy with the previous page
+    uint32_t pending_addr = 0;
+    uint32_t pending_size = 0;
+    uint32_t addr = start_addr;
+    while(addr < end) {
+        if(op_cancelled(control)) {
+            result = EEPROMOpCancelled;
+            break;
+        }
+
+        // Write one aligned native page
+        uint32_t chunk_size = page_chunk(addr, end, page_size);
+        uint8_t* page = pages[slot];
+
+        // Normally staged during the previous write cycle already
+        if(stream_ring_count(ring) < chunk_size) {
+            session.yield();
+            if(!stream_ring_fill(ring, source, source_context, &source_remaining)) {
+                result = EEPROMOpSourceError;
+                break;
+            }
+        }
+        stream_ring_take(ring, page, chunk_size);
+        stats->crc = eeprom_crc32(stats->crc, page, chunk_size);
+
+        // ACK polling hands the chip back the moment its write cycle ends
+        if(write_pending) {
+            write_pending = false;
+            result = write_finish_page(
+                eeprom, pending_addr, pages[slot ^ 1], pending_size, verify, current, stats);
+            if(result != EEPROMOpOk) break;
+            if(mirror) memcpy(&mirror[pending_addr - start_addr], current, pending_size);
+        }
+
+        // Smart write: a page that already matches costs one read, no write cycle
+        if(smart && eeprom->readBytes(addr, current, chunk_size) &&
+           memcmp(current, page, chunk_size) == 0) {
+            stats->pages_skipped++;
+            if(mirror) memcpy(&mirror[addr - start_addr], page, chunk_size);
+        } else if(eeprom->beginPageWrite(addr, page, chunk_size)) {
+            stats->pages_written++;
+            write_pending = true;
+            pending_addr = addr;
+            pending_size = chunk_size;
+            slot ^= 1;
+        } else {
+            result = EEPROMOpWriteError;
+            break;
+        }
+        addr += chunk_size;
+        op_progress(control, addr - start_addr, length);
+
+        // Stage the next page from the source while the chip commits this one
+        if(addr < end && stream_ring_count(ring) < page_chunk(addr, end, page_size)) {
+            session.yield();
+            if(!stream_ring_fill(ring, source, source_context, &source_remaining)) {
+                result = EEPROMOpSourceError;
+                break;
+            }
+        }
+    }
+
+    // Last page is committed (and checked) before the caller reads anything back
+    if(write_pending) {
+        EEPROMOpResult finish = write_finish_page(
+            eeprom, pending_addr, pages[slot ^ 1], pending_size, verify, current, stats);
+        if(finish == EEPROMOpOk && mirror) {
+            memcpy(&mirror[pending_addr - start_addr], current, pending_size);
+        }
+        if(result == EEPROMOpOk) result = finish;
+    }
+    if(result == EEPROMOpOk && stats->bytes_failed > 0) {
+        result = EEPROMOpMismatch;
+    }
+
+    free(page_buffers);
+    free(ring);
+    return result;
+}
+
+EEPROMOpResult eeprom_op_commit(
+    EEPROM24C02* eeprom,
+    EEPROMEditBuffer* edits,
+    const EEPROMOpControl* control,
+    EEPROMWriteStats* stats) {
+    uint16_t page_size = edits->page_size;
+    // Page buffers stay off the worker stack
+    uint8_t* page = static_cast<uint8_t*>(malloc(EEPROM_MAX_PAGE_SIZE * 2));
+    write_stats_reset(stats);
+    if(page == nullptr) return EEPROMOpNoMemory;
+    uint8_t* chip = page + EEPROM_MAX_PAGE_SIZE;
+
+    EEPROMBusSession session(*eeprom);
+    EEPROMOpResult result = EEPROMOpOk;
+    uint32_t total = eeprom_edit_dirty_pages(edits);
+    uint32_t done = 0;
+    uint32_t index = 0;
+    while(eeprom_edit_next_dirty(edits, index, &index)) {
+        if(op_cancelled(control)) {
+            result = EEPROMOpCancelled;
+            break;
+        }
+        session.yield();
+
+        // A fully edited page needs no read-modify-write
+        uint32_t addr = index * page_size;
+        bool partial = eeprom_edit_apply(edits, addr, page, page_size) < page_size;
+        if(partial) {
+            if(!eeprom->readBytes(addr, chip, page_size)) {
+                result = EEPROMOpReadError;
+                break;
+            }
+            memcpy(page, chip, page_size);
+            eeprom_edit_apply(edits, addr, page, page_size);
+        }
+
+        uint32_t failed = stats->bytes_failed;
+        if(partial && memcmp(page, chip, page_size) == 0) {
+            stats->pages_skipped++;
+        } else if(eeprom->beginPageWrite(addr, page, page_size)) {
+            stats->pages_written++;
+            result = write_finish_page(eeprom, addr, page, page_size, true, chip, stats);
+            if(result != EEPROMOpOk) break;
+        } else {
+            result = EEPROMOpWriteError;
+            break;
+        }
+        // Bytes that would not stick stay pending
+        if(stats->bytes_failed == failed) eeprom_edit_drop_page(edits, index);
+
+        index++;
+        op_progress(control, ++done, total);
+    }
+    if(result == EEPROMOpOk && stats->bytes_failed > 0) {
+        result = EEPROMOpMismatch;
+    }
+
+    free(page);
+    return result;
+}
+
+static void verify_stats_reset(EEPROMVerifyStats* stats) {
+    memset(stats, 0, sizeof(EEPROMVerifyStats));
+}
+
+EEPROMOpResult eeprom_op_verify(
+    EEPROM24C02* eeprom,
+    uint32_t start_addr,
+    uint32_t length,
+    EEPROMSourceCallback source,
+    void* source_context,
+    uint8_t* mirror,
+    const EEPROMOpControl* control,
+    EEPROMVerifyStats* stats) {
+    uint8_t* chip_chunk = static_cast<uint8_t*>(malloc(EEPROM_OP_VERIFY_CHUNK * 2));
+    verify_stats_reset(stats);
+    if(chip_chunk == nullptr) return EEPROMOpNoMemory;
+    uint8_t* file_chunk = chip_chunk + EEPROM_OP_VERIFY_CHUNK;
+
+    EEPROMBusSession session(*eeprom);
+    EEPROMOpResult result = EEPROMOpOk;
+    uint32_t done = 0;
+    while(done < length) {
+        if(op_cancelled(control)) {
+            result = EEPROMOpCancelled;
+            break;
+        }
+        session.yield();
+
+        uint32_t chunk_size = EEPROM_OP_VERIFY_CHUNK;
+        if(done + chunk_size > length) chunk_size = length - done;
+
+        if(!eeprom->readBytes(start_addr + done, chip_chunk, chunk_size)) {
+            result = EEPROMOpReadError;
+            break;
+        }
+        if(!source(source_context, file_chunk, chunk_size)) {
+            result = EEPROMOpSourceError;
+            break;
+        }
+
+        if(mirror) memcpy(&mirror[done], chip_chunk, chunk_size);
+        stats->crc = eeprom_crc32(stats->crc, chip_chunk, chunk_size);
+        if(memcmp(chip_chunk, file_chunk, chunk_size) != 0) {
+            for(uint32_t i = 0; i < chunk_size; i++) {
+                if(chip_chunk[i] == file_chunk[i]) continue;
+                if(stats->bytes_differ == 0) stats->first_difference = start_addr + done + i;
+                stats->bytes_differ++;
+            }
+        }
+
+        done += chunk_size;
+        op_progress(control, done, length);
+    }
+    if(result == EEPROMOpOk && stats->bytes_differ > 0) {
+        result = EEPROMOpMismatch;
+    }
+
+    free(chip_chunk);
+    return result;
+}
+
+EEPROMOpResult eeprom_op_verify_crc(
+    EEPROM24C02* eeprom,
+    uint32_t start_addr,
+    uint32_t length,
+    uint32_t expected_crc,
+    uint8_t* mirror,
+    const EEPROMOpControl* control,
+    EEPROMVerifyStats* stats) {
+    // With a mirror the chip is read straight into it
+    uint8_t* buffer = nullptr;
+    if(!mirror) buffer = static_cast<uint8_t*>(malloc(EEPROM_OP_DUMP_CHUNK));
+    verify_stats_reset(stats);
+    if(!mirror && buffer == nullptr) return EEPROMOpNoMemory;
+
+    EEPROMBusSession session(*eeprom);
+    EEPROMOpResult result = EEPROMOpOk;
+    uint32_t done = 0;
+    while(done < length) {
+        if(op_cancelled(control)) {
+            result = EEPROMOpCancelled;
+            break;
+        }
+        session.yield();
+
+        uint32_t chunk_size = EEPROM_OP_DUMP_CHUNK;
+        if(done + chunk_size > length) chunk_size = length - done;
+
+        uint8_t* chunk = mirror ? &mirror[done] : buffer;
+        if(!eeprom->readSequential(start_addr + done, chunk, chunk_size)) {
+            result = EEPROMOpReadError;
+            break;
+        }
+        stats->crc = eeprom_crc32(stats->crc, chunk, chunk_size);
+
+        done += chunk_size;
+        op_progress(control, done, length);
+    }
+    if(result == EEPROMOpOk && stats->crc != expected_crc) {
+        result = EEPROMOpMismatch;
+    }
+
+    free(buffer);
+    return result;
+}
+
+EEPROMOpResult eeprom_op_dump(
+    EEPROM24C02* eeprom,
+    uint32_t start_addr,
+    uint32_t length,
+    const EEPROMDumpSink* sink,
+    uint32_t* crc,
+    const EEPROMOpControl* control) {
+    EEPROMBusSession session(*eeprom);
+    uint32_t dump_crc = EEPROM_CRC32_INIT;
+    uint32_t done = 0;
+    while(done < length) {
+        if(op_cancelled(control)) {
+            return EEPROMOpCancelled;
+        }
+        session.yield();
+
+        // Waits until the sink is done with an earlier buffer
+        uint8_t* buffer = sink->acquire(sink->context);
+
+        uint32_t chunk_size = EEPROM_OP_DUMP_CHUNK;
+        if(done + chunk_size > length) chunk_size = length - done;
+
+        if(!eeprom->readSequential(start_addr + done, buffer, chunk_size)) {
+            return EEPROMOpReadError;
+        }
+        // Buffer belongs to the sink once submitted
+        dump_crc = eeprom_crc32(dump_crc, buffer, chunk_size);
+        if(!sink->submit(sink->context, buffer, chunk_size)) {
+            return EEPROMOpSinkError;
+        }
+
+        done += chunk_size;
+        op_progress(control, done, length);
+    }
+
+    if(crc) *crc = dump_crc;
+    return EEPROMOpOk;
+}
+
+EEPROMOpResult eeprom_op_block_summary(
+    EEPROM24C02* eeprom,
+    uint32_t start_addr,
+    uint32_t length,
+    uint8_t* bitmap,
+    const EEPROMOpControl* control) {
+    uint8_t* block = static_cast<uint8_t*>(malloc(EEPROM_OP_SUMMARY_BLOCK));
+    if(block == nullptr) return EEPROMOpNoMemory;
+    memset(bitmap, 0, (length + EEPROM_OP_SUMMARY_BLOCK * 8 - 1) / (EEPROM_OP_SUMMARY_BLOCK * 8));
+
+    EEPROMBusSession session(*eeprom);
+    EEPROMOpResult result = EEPROMOpOk;
+    uint32_t done = 0;
+    for(uint32_t index = 0; done < length; index++) {
+        if(op_cancelled(control)) {
+            result = EEPROMOpCancelled;
+            break;
+        }
+        session.yield();
+
+        uint32_t chunk_size = EEPROM_OP_SUMMARY_BLOCK;
+        if(done + chunk_size > length) chunk_size = length - done;
+
+        if(!eeprom->readSequential(start_addr + done, block, chunk_size)) {
+            result = EEPROMOpReadError;
+            break;
+        }
+        if(!is_blank(block, chunk_size)) bitmap[index / 8] |= 1 << (index % 8);
+
+        done += chunk_size;
+        op_progress(control, done, length);
+    }
+
+    free(block);
+    return result;
+}
+
+EEPROMOpResult eeprom_op_search(
+    EEPROM24C02* eeprom,
+    uint32_t start_addr,
+    uint32_t length,
+    const EEPROMPattern* pattern,
+    bool backward,
+    uint32_t* match,
+    const EEPROMOpControl* control) {
+    if(pattern->length == 0) return EEPROMOpNotFound;
+
+    // Chunk plus the bytes of a match that may straddle the previous chunk
+    uint32_t carry_max = pattern->length - 1;
+    uint8_t* window = static_cast<uint8_t*>(malloc(EEPROM_OP_SEARCH_CHUNK + EEPROM_PATTERN_MAX));
+    if(window == nullptr) return EEPROMOpNoMemory;
+
+    EEPROMBusSession session(*eeprom);
+    EEPROMOpResult result = EEPROMOpNotFound;
+    uint32_t carry = 0;
+    uint32_t done = 0;
+    while(done < length) {
+        if(op_cancelled(control)) {
+            result = EEPROMOpCancelled;
+            break;
+        }
+        session.yield();
+
+        uint32_t chunk_size = EEPROM_OP_SEARCH_CHUNK;
+        if(done + chunk_size > length) chunk_size = length - done;
+
+        // Forward windows are carry + chunk, backward ones chunk + carry
+        uint32_t chunk_addr = backward ? start_addr + length - done - chunk_size :
+                                         start_addr + done;
+        uint8_t* chunk = window;
+        if(backward) {
+            memmove(&window[chunk_size], window, carry);
+        } else {
+            chunk = &window[carry];
+        }
+        if(!eeprom->readSequential(chunk_addr, chunk, chunk_size)) {
+            result = EEPROMOpReadError;
+            break;
+        }
+
+        uint32_t window_size = carry + chunk_size;
+        if(backward) {
+            int32_t offset = eeprom_pattern_find_last(pattern, window, window_size);
+            if(offset >= 0) {
+                *match = chunk_addr + offset;
+                result = EEPROMOpOk;
+                break;
+            }
+        } else {
+            int32_t offset = eeprom_pattern_find(pattern, window, window_size);
+            if(offset >= 0) {
+                *match = chunk_addr - carry + offset;
+                result = EEPROMOpOk;
+                break;
+            }
+        }
+
+        carry = window_size < carry_max ? window_size : carry_max;
+        if(!backward) memmove(window, &window[window_size - carry], carry);
+
+        done += chunk_size;
+        op_progress(control, done, length);
+    }
+
+    free(window);
+    return result;
+}
+
+// Chips of the gang that have not failed yet
+static uint8_t gang_active(const EEPROMGang* gang) {
+    uint8_t active = 0;
+    for(uint8_t i = 0; i < gang->count; i++) {
+        if(gang->results[i] == EEPROMOpOk) active++;
+    }
+    return active;
+}
+
+EEPROMOpResult eeprom_op_gang_write(
+    EEPROM24C02* eeprom,
+    EEPROMGang* gang,
+    uint32_t start_addr,
+    uint32_t length,
+    EEPROMSourceCallback source,
+    void* source_context,
+    bool smart,
+    const EEPROMOpControl* control,
+    EEPROMWriteStats* stats) {
+    uint16_t page_size = eeprom->getGeometry().page_size;
+    uint8_t address = eeprom->getAddress();
+    uint32_t end = start_addr + length;
+    StreamRing* ring = static_cast<StreamRing*>(malloc(sizeof(StreamRing)));
+    // Page buffers stay off the worker stack
+    uint8_t* page = static_cast<uint8_t*>(malloc(EEPROM_MAX_PAGE_SIZE * 2));
+    write_stats_reset(stats);
+    if(ring == nullptr || page == nullptr) {
+        free(page);
+        free(ring);
+        return EEPROMOpNoMemory;
+    }
+    ring->head = 0;
+    ring->tail = 0;
+
+    uint8_t* current = page + EEPROM_MAX_PAGE_SIZE;
+    bool write_pending[EEPROM_GANG_MAX] = {false};
+    EEPROMBusSession session(*eeprom);
+    EEPROMOpResult result = EEPROMOpOk;
+    uint32_t source_remaining = length;
+    uint32_t addr = start_addr;
+    while(addr < end) {
+        if(op_cancelled(control)) {
+            result = EEPROMOpCancelled;
+            break;
+        }
+
+        uint32_t chunk_size = page_chunk(addr, end, page_size);
+        if(stream_ring_count(ring) < chunk_size) {
+            session.yield();
+            if(!stream_ring_fill(ring, source, source_context, &source_remaining)) {
+                result = EEPROMOpSourceError;
+                break;
+            }
+        }
+        stream_ring_take(ring, page, chunk_size);
+        stats->crc = eeprom_crc32(stats->crc, page, chunk_size);
+
+        // Round robin: by the time a chip comes up again its write cycle is
+        // usually over, so ACK polling costs a single probe
+        for(uint8_t i = 0; i < gang->count; i++) {
+            if(gang->results[i] != EEPROMOpOk) continue;
+            eeprom->setAddress(gang->addresses[i]);
+
+            if(write_pending[i]) {
+                write_pending[i] = false;
+                if(!eeprom->waitWriteComplete()) {
+                    gang->results[i] = EEPROMOpWriteError;
+                    continue;
+                }
+                write_stats_polls(eeprom, stats);
+            }
+
+            if(smart && eeprom->readBytes(addr, current, chunk_size) &&
+               memcmp(current, page, chunk_size) == 0) {
+                stats->pages_skipped++;
+            } else if(eeprom->beginPageWrite(addr, page, chunk_size)) {
+                stats->pages_written++;
+                write_pending[i] = true;
+            } else {
+                gang->results[i] = EEPROMOpWriteError;
+            }
+        }
+
+        if(gang_active(gang) == 0) {
+            result = EEPROMOpWriteError;
+            break;
+        }
+        addr += chunk_size;
+        op_progress(control, addr - start_addr, length);
+
+        // Stage the next page while the chips commit this one
+        if(addr < end && stream_ring_count(ring) < page_chunk(addr, end, page_size)) {
+            session.yield();
+            if(!stream_ring_fill(ring, source, source_context, &source_remaining)) {
+                result = EEPROMOpSourceError;
+                break;
+            }
+        }
+    }
+
+    // Last pages are committed before anything is read back
+    for(uint8_t i = 0; i < gang->count; i++) {
+        if(!write_pending[i]) continue;
+        eeprom->setAddress(gang->addresses[i]);
+        if(eeprom->waitWriteComplete()) {
+            write_stats_polls(eeprom, stats);
+        } else {
+            gang->results[i] = EEPROMOpWriteError;
+        }
+    }
+    if(result == EEPROMOpOk && gang_active(gang) == 0) {
+        result = EEPROMOpWriteError;
+    }
+
+    eeprom->setAddress(address);
+    free(page);
+    free(ring);
+    return result;
+}
+
+EEPROMOpResult eeprom_op_gang_verify(
+    EEPROM24C02* eeprom,
+    EEPROMGang* gang,
+    uint32_t start_addr,
+    uint32_t length,
+    EEPROMSourceCallback source,
+    void* source_context,
+    const EEPROMOpControl* control) {
+    uint8_t address = eeprom->getAddress();
+    uint8_t* chip_chunk = static_cast<uint8_t*>(malloc(EEPROM_OP_VERIFY_CHUNK * 2));
+    if(chip_chunk == nullptr) return EEPROMOpNoMemory;
+    uint8_t* file_chunk = chip_chunk + EEPROM_OP_VERIFY_CHUNK;
+
+    EEPROMBusSession session(*eeprom);
+    EEPROMOpResult result = EEPROMOpOk;
+    uint32_t done = 0;
+    while(done < length && gang_active(gang) > 0) {
+        if(op_cancelled(control)) {
+            result = EEPROMOpCancelled;
+            break;
+        }
+        session.yield();
+
+        uint32_t chunk_size = EEPROM_OP_VERIFY_CHUNK;
+        if(done + chunk_size > length) chunk_size = length - done;
+
+        // Source is read once per chunk for all chips
+        if(!source(source_context, file_chunk, chunk_size)) {
+            result = EEPROMOpSourceError;
+            break;
+        }
+
+        for(uint8_t i = 0; i < gang->count; i++) {
+            if(gang->results[i] != EEPROMOpOk) continue;
+            eeprom->setAddress(gang->addresses[i]);
+
+            if(!eeprom->readBytes(start_addr + done, chip_chunk, chunk_size)) {
+                gang->results[i] = EEPROMOpReadError;
+            } else if(memcmp(chip_chunk, file_chunk, chunk_size) != 0) {
+                gang->results[i] = EEPROMOpMismatch;
+            }
+        }
+
+        done += chunk_size;
+        op_progress(control, done, length);
+    }
+
+    if(result == EEPROMOpOk && gang_active(gang) < gang->count) {
+        result = EEPROMOpMismatch;
+    }
+
+    eeprom->setAddress(address);
+    free(chip_chunk);
+    return result;
+}
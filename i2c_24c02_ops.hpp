@@ -0,0 +1,193 @@
+#pragma once
+
+#include "i2c_24c02.hpp"
+#include "i2c_24c02_crc.hpp"
+#include "i2c_24c02_search.hpp"
+#include "i2c_24c02_edit.hpp"
+
+// Bulk EEPROM operations shared by the Flipper app and host tools
+// Files are reached through callbacks so no storage API is needed here
+
+#define EEPROM_OP_RING_SIZE    1024 // Power of two, holds several native pages
+#define EEPROM_OP_VERIFY_CHUNK 256 // Verify readback chunk
+#define EEPROM_OP_DUMP_CHUNK   1024 // Size of each buffer handed out by a dump sink
+#define EEPROM_OP_ERASE_BLOCK  1024 // Blank check read-ahead, multiple of any page size
+#define EEPROM_OP_WRITE_RETRIES 3 // Rewrites of a page that reads back wrong
+#define EEPROM_OP_FAILED_REPORT 8 // Failing addresses kept in EEPROMWriteStats
+#define EEPROM_OP_SUMMARY_BLOCK 256 // Bytes covered by one bit of a block summary
+#define EEPROM_OP_SEARCH_CHUNK  512 // Search read size, a pattern tail is carried across chunks
+
+typedef enum {
+    EEPROMOpOk,
+    EEPROMOpCancelled,
+    EEPROMOpReadError, // EEPROM read failed
+    EEPROMOpWriteError, // EEPROM write or write cycle failed
+    EEPROMOpSourceError, // Input stream ended or failed
+    EEPROMOpSinkError, // Output stream failed
+    EEPROMOpMismatch, // Verify found a difference
+    EEPROMOpNotFound, // Search found no match
+    EEPROMOpNoMemory, // Working buffers could not be allocated, nothing was transferred
+} EEPROMOpResult;
+
+// Read exactly length bytes of input, false on error
+typedef bool (*EEPROMSourceCallback)(void* context, uint8_t* buffer, uint32_t length);
+
+// Output of a dump: buffers of EEPROM_OP_DUMP_CHUNK bytes are taken, filled and submitted
+typedef struct {
+    uint8_t* (*acquire)(void* context);
+    bool (*submit)(void* context, uint8_t* buffer, uint32_t length);
+    void* context;
+} EEPROMDumpSink;
+
+// Progress reporting and cancellation, all fields optional
+typedef struct {
+    EEPROMProgressCallback progress; // Bytes done within the operation
+    void* context;
+    const volatile bool* cancel;
+} EEPROMOpControl;
+
+typedef struct {
+    uint32_t pages_written;
+    uint32_t pages_skipped; // Already matched the input
+    uint32_t pages_retried; // Rewrites after a bad readback
+    uint32_t bytes_failed; // Still wrong after all rewrites
+    uint32_t failed_addresses[EEPROM_OP_FAILED_REPORT]; // First bytes_failed addresses
+    uint32_t crc; // CRC32 of the source data
+    uint32_t ack_polls; // Driver ACK polls over all page write cycles
+    uint16_t max_page_polls; // Most ACK polls a single page write cycle needed
+} EEPROMWriteStats;
+
+typedef struct {
+    uint32_t crc; // CRC32 of the chip contents read
+    uint32_t bytes_differ; // Only counted by the chunked compare
+    uint32_t first_difference; // Address of the first differing byte
+} EEPROMVerifyStats;
+
+typedef struct {
+    uint32_t pages_erased;
+    uint32_t pages_skipped; // Already blank
+} EEPROMEraseStats;
+
+// One chip per address 0x50-0x57
+#define EEPROM_GANG_MAX 8
+
+// Identical chips programmed together through one driver by switching its
+// address; a chip drops out of the gang at its first failure
+typedef struct {
+    uint8_t count;
+    uint8_t addresses[EEPROM_GANG_MAX]; // 7-bit I2C addresses
+    EEPROMOpResult results[EEPROM_GANG_MAX]; // Set to EEPROMOpOk by the caller
+} EEPROMGang;
+
+// Fill range with 0xFF, skipping pages that are already blank
+EEPROMOpResult eeprom_op_erase(
+    EEPROM24C02* eeprom,
+    uint32_t start_addr,
+    uint32_t length,
+    const EEPROMOpControl* control,
+    EEPROMEraseStats* stats);
+
+// Write range from source page by page, smart mode skips pages that already match
+// Source reads for the next page run during the current page's write cycle
+// With verify each page is read back once written and rewritten up to
+// EEPROM_OP_WRITE_RETRIES times; bytes still wrong after that are listed in
+// stats and make the result Mismatch. Chip contents are copied to mirror when given
+EEPROMOpResult eeprom_op_write(
+    EEPROM24C02* eeprom,
+    uint32_t start_addr,
+    uint32_t length,
+    EEPROMSourceCallback source,
+    void* source_context,
+    bool smart,
+    bool verify,
+    uint8_t* mirror,
+    const EEPROMOpControl* control,
+    EEPROMWriteStats* stats);
+
+// Compare range with source chunk by chunk, readback is copied to mirror when given
+// The whole range is compared so stats count every differing byte
+EEPROMOpResult eeprom_op_verify(
+    EEPROM24C02* eeprom,
+    uint32_t start_addr,
+    uint32_t length,
+    EEPROMSourceCallback source,
+    void* source_context,
+    uint8_t* mirror,
+    const EEPROMOpControl* control,
+    EEPROMVerifyStats* stats);
+
+// Single sequential read pass comparing the range's CRC32 with expected_crc
+// Needs no source; Mismatch only says the checksums differ, run eeprom_op_verify
+// to locate the bytes. Readback is copied to mirror when given
+EEPROMOpResult eeprom_op_verify_crc(
+    EEPROM24C02* eeprom,
+    uint32_t start_addr,
+    uint32_t length,
+    uint32_t expected_crc,
+    uint8_t* mirror,
+    const EEPROMOpControl* control,
+    EEPROMVerifyStats* stats);
+
+// Stream range into sink, CRC32 of the data goes to crc when given
+EEPROMOpResult eeprom_op_dump(
+    EEPROM24C02* eeprom,
+    uint32_t start_addr,
+    uint32_t length,
+    const EEPROMDumpSink* sink,
+    uint32_t* crc,
+    const EEPROMOpControl* control);
+
+// One sequential read pass marking every EEPROM_OP_SUMMARY_BLOCK of the range that
+// holds anything but 0xFF: bit (i % 8) of bitmap[i / 8] for block i
+EEPROMOpResult eeprom_op_block_summary(
+    EEPROM24C02* eeprom,
+    uint32_t start_addr,
+    uint32_t length,
+    uint8_t* bitmap,
+    const EEPROMOpControl* control);
+
+// Write every page holding edits as one full native page, reading the chip first
+// when only part of the page was edited; pages that already match are skipped
+// Each page is read back and rewritten like eeprom_op_write() with verify, and its
+// edits are dropped once it is on the chip, so after a failure only the rest remain
+EEPROMOpResult eeprom_op_commit(
+    EEPROM24C02* eeprom,
+    EEPROMEditBuffer* edits,
+    const EEPROMOpControl* control,
+    EEPROMWriteStats* stats);
+
+// Stream range looking for pattern; match gets the address of the first match lying
+// entirely inside the range, or the last one when backward (read from the end down)
+EEPROMOpResult eeprom_op_search(
+    EEPROM24C02* eeprom,
+    uint32_t start_addr,
+    uint32_t length,
+    const EEPROMPattern* pattern,
+    bool backward,
+    uint32_t* match,
+    const EEPROMOpControl* control);
+
+// Write range from source to every chip of the gang, page by page
+// Each page goes to the next chip while the previous ones run their write cycle
+// Stats add up over all chips; WriteError only when every chip failed
+EEPROMOpResult eeprom_op_gang_write(
+    EEPROM24C02* eeprom,
+    EEPROMGang* gang,
+    uint32_t start_addr,
+    uint32_t length,
+    EEPROMSourceCallback source,
+    void* source_context,
+    bool smart,
+    const EEPROMOpControl* control,
+    EEPROMWriteStats* stats);
+
+// Compare every remaining chip of the gang with one pass over source
+// Per-chip outcome lands in gang->results; Mismatch if any chip differs
+EEPROMOpResult eeprom_op_gang_verify(
+    EEPROM24C02* eeprom,
+    EEPROMGang* gang,
+    uint32_t start_addr,
+    uint32_t length,
+    EEPROMSourceCallback source,
+    void* source_context,
+    const EEPROMOpControl* control);
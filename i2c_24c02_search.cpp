@@ -0,0 +1,102 @@
+#include "i2c_24c02_search.hpp"
+#include <ctype.h>
+#include <string.h>
+
+static_assert(EEPROM_PATTERN_MAX <= 255, "skip tables hold shifts in bytes");
+
+void eeprom_pattern_compile(EEPROMPattern* pattern) {
+    uint8_t length = pattern->length;
+    if(length == 0) return;
+
+    // A wildcard matches any byte, so no shift may carry the pattern past it
+    uint8_t forward = length;
+    uint8_t backward = length;
+    for(uint8_t i = 0; i + 1 < length; i++) {
+        if(pattern->wild[i]) forward = length - 1 - i;
+    }
+    for(uint8_t i = length - 1; i > 0; i--) {
+        if(pattern->wild[i]) backward = i;
+    }
+    memset(pattern->skip_forward, forward, sizeof(pattern->skip_forward));
+    memset(pattern->skip_backward, backward, sizeof(pattern->skip_backward));
+
+    // Rightmost (leftmost) occurrence wins, limited by the wildcard bound
+    for(uint8_t i = 0; i + 1 < length; i++) {
+        uint8_t shift = length - 1 - i;
+        uint8_t* entry = &pattern->skip_forward[pattern->bytes[i]];
+        if(!pattern->wild[i] && shift < *entry) *entry = shift;
+    }
+    for(uint8_t i = length - 1; i > 0; i--) {
+        uint8_t* entry = &pattern->skip_backward[pattern->bytes[i]];
+        if(!pattern->wild[i] && i < *entry) *entry = i;
+    }
+}
+
+static int hex_value(char c) {
+    if(c >= '0' && c <= '9') return c - '0';
+    c = (char)toupper((unsigned char)c);
+    if(c >= 'A' && c <= 'F') return c - 'A' + 10;
+    return -1;
+}
+
+bool eeprom_pattern_parse(EEPROMPattern* pattern, const char* text) {
+    uint8_t length = 0;
+    while(*text) {
+        if(*text == ' ') {
+            text++;
+            continue;
+        }
+        if(length == EEPROM_PATTERN_MAX || !text[1]) return false;
+
+        if(text[0] == '?' && text[1] == '?') {
+            pattern->bytes[length] = 0;
+            pattern->wild[length] = true;
+        } else {
+            int high = hex_value(text[0]);
+            int low = hex_value(text[1]);
+            if(high < 0 || low < 0) return false;
+            pattern->bytes[length] = (uint8_t)(high << 4 | low);
+            pattern->wild[length] = false;
+        }
+        length++;
+        text += 2;
+    }
+    if(length == 0) return false;
+
+    pattern->length = length;
+    eeprom_pattern_compile(pattern);
+    return true;
+}
+
+static bool pattern_matches(const EEPROMPattern* pattern, const uint8_t* data) {
+    for(uint8_t i = 0; i < pattern->length; i++) {
+        if(!pattern->wild[i] && data[i] != pattern->bytes[i]) return false;
+    }
+    return true;
+}
+
+int32_t eeprom_pattern_find(const EEPROMPattern* pattern, const uint8_t* data, uint32_t length) {
+    uint32_t size = pattern->length;
+    if(size == 0 || length < size) return -1;
+
+    for(uint32_t pos = 0; pos <= length - size;) {
+        if(pattern_matches(pattern, data + pos)) return (int32_t)pos;
+        pos += pattern->skip_forward[data[pos + size - 1]];
+    }
+    return -1;
+}
+
+int32_t
+    eeprom_pattern_find_last(const EEPROMPattern* pattern, const uint8_t* data, uint32_t length) {
+    uint32_t size = pattern->length;
+    if(size == 0 || length < size) return -1;
+
+    // pos counts back from the last window so it never goes below zero
+    for(uint32_t pos = length - size + 1; pos > 0;) {
+        const uint8_t* window = data + pos - 1;
+        if(pattern_matches(pattern, window)) return (int32_t)(pos - 1);
+        uint8_t shift = pattern->skip_backward[window[0]];
+        pos = pos > shift ? pos - shift : 0;
+    }
+    return -1;
+}
@@ -0,0 +1,30 @@
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+
+// Byte pattern search with whole-byte wildcards, Boyer-Moore-Horspool in both directions
+// Platform-free: the owner streams chip contents through eeprom_pattern_find*()
+
+#define EEPROM_PATTERN_MAX 8 // Bytes per pattern, enough for a MAC or a file magic
+
+typedef struct {
+    uint8_t length;
+    uint8_t bytes[EEPROM_PATTERN_MAX];
+    bool wild[EEPROM_PATTERN_MAX]; // Byte matches anything
+    uint8_t skip_forward[256]; // Shift on the byte under the pattern's last position
+    uint8_t skip_backward[256]; // Shift on the byte under the pattern's first position
+} EEPROMPattern;
+
+// Rebuild the skip tables after bytes, wild or length changed
+void eeprom_pattern_compile(EEPROMPattern* pattern);
+
+// Parse hex text such as "DEADBEEF" or "de ad ?? ef" and compile it, false if malformed
+bool eeprom_pattern_parse(EEPROMPattern* pattern, const char* text);
+
+// Offset of the first match lying entirely inside data, -1 if none
+int32_t eeprom_pattern_find(const EEPROMPattern* pattern, const uint8_t* data, uint32_t length);
+
+// Offset of the last match lying entirely inside data, -1 if none
+int32_t
+    eeprom_pattern_find_last(const EEPROMPattern* pattern, const uint8_t* data, uint32_t length);
@@ -0,0 +1,63 @@
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+// How a transfer begins on the bus
+typedef enum {
+    EEPROMBusBeginStart, // START condition
+    EEPROMBusBeginRestart, // Repeated START after EEPROMBusEndAwaitRestart
+} EEPROMBusBegin;
+
+// How a transfer ends on the bus
+typedef enum {
+    EEPROMBusEndStop, // STOP condition
+    EEPROMBusEndAwaitRestart, // Keep the bus for a repeated START
+} EEPROMBusEnd;
+
+// Standard bus clocks supported by 24Cxx parts
+#define EEPROM_BUS_CLOCK_STANDARD  100000
+#define EEPROM_BUS_CLOCK_FAST      400000
+#define EEPROM_BUS_CLOCK_FAST_PLUS 1000000
+
+// I2C bus used by the EEPROM driver
+// Flipper HAL on device (i2c_24c02_hal), simulated 24Cxx parts on host (host/)
+// Device addresses are 8-bit (7-bit address << 1)
+class EEPROMTransport {
+public:
+    virtual ~EEPROMTransport() {
+    }
+
+    // Exclusive bus access around a group of transfers
+    virtual void acquire() = 0;
+    virtual void release() = 0;
+
+    // Master transmit, false on NACK or timeout
+    virtual bool tx(
+        uint8_t address,
+        const uint8_t* data,
+        size_t size,
+        EEPROMBusBegin begin,
+        EEPROMBusEnd end,
+        uint32_t timeout) = 0;
+
+    // Master receive, false on NACK or timeout
+    virtual bool rx(
+        uint8_t address,
+        uint8_t* data,
+        size_t size,
+        EEPROMBusBegin begin,
+        EEPROMBusEnd end,
+        uint32_t timeout) = 0;
+
+    // Address-only probe, true if device ACKs
+    virtual bool isDeviceReady(uint8_t address, uint32_t timeout) = 0;
+
+    // Millisecond tick used for timeouts
+    virtual uint32_t getTick() = 0;
+
+    // Bus clock in Hz: 100 kHz Standard, 400 kHz Fast, 1 MHz Fast-mode Plus
+    virtual void setClock(uint32_t clock_hz) = 0;
+    virtual uint32_t getClock() = 0;
+};